@@ -0,0 +1,253 @@
+#include "main.h"
+
+#include "arm-controller.hpp"
+
+#include <cmath>
+
+ArmController::ArmController(MotorGroup* arm, double gear_ratio,
+							 double rest_angle)
+{
+	/*
+	   Constructor for arm controller.  Takes the arm
+	   motor group, the number of motor degrees per
+	   degree of arm travel and the angle (degrees
+	   from horizontal) of the arm at encoder
+	   position 0.
+	*/
+
+	this->arm = arm;
+	this->gear_ratio = gear_ratio;
+	this->rest_angle = rest_angle;
+}
+
+void ArmController::set_gravity(double kG)
+{
+	/*
+	   Sets the power (-127 to 127) needed to hold
+	   the arm level.  The feedforward is
+	   kG * cos(angle).
+	*/
+
+	this->kG = kG;
+}
+
+void ArmController::set_gains(double kP, double kD, double kV)
+{
+	/*
+	   Sets the constants of the controller.
+
+	   kP and kD act on the position and velocity
+	   error from the profile, kV turns the profile
+	   velocity (degrees / s) into power.
+	*/
+
+	this->kP = kP;
+	this->kD = kD;
+	this->kV = kV;
+}
+
+void ArmController::set_limits(double max_velocity, double acceleration)
+{
+	/*
+	   Sets the fastest speed (motor degrees / s)
+	   and acceleration (degrees / s^2) of profiled
+	   moves.
+	*/
+
+	this->max_velocity = max_velocity;
+	this->acceleration = acceleration;
+}
+
+double ArmController::get_angle()
+{
+	/*
+	   Returns the angle of the arm in radians from
+	   horizontal.
+	*/
+
+	double degrees = arm->get_signed_position() / gear_ratio + rest_angle;
+	return degrees * M_PI / 180;
+}
+
+double ArmController::get_velocity()
+{
+	/*
+	   Returns the velocity of the arm in motor
+	   degrees per second, from the encoder
+	   timestamps so the D term isn't working off a
+	   delayed reading.  Negative while the arm is
+	   lowered.
+	*/
+
+	return arm->get_signed_velocity();
+}
+
+void ArmController::set_target(int position)
+{
+	/*
+	   Starts a profiled move to an encoder position
+	   from wherever the arm is now.
+
+	   The move is carried out by update().
+	*/
+
+	if(!active)
+	{
+		setpoint = arm->get_signed_position();
+		setpoint_velocity = 0;
+	}
+	target = position;
+	active = true;
+}
+
+void ArmController::manual(int button_one, int button_two)
+{
+	/*
+	   Drives the arm by buttons like
+	   MotorGroup::run(int, int).
+
+	   While a button is held the profile is off.
+	   Once both are released the arm holds where it
+	   stopped.
+	*/
+
+	if(button_one || button_two)
+	{
+		arm->run(button_one, button_two);
+		active = false;
+	}
+	else if(!active)
+	{
+		set_target(arm->get_signed_position());
+	}
+}
+
+void ArmController::step_profile()
+{
+	/*
+	   Advances the profile setpoint by one step.
+
+	   The setpoint accelerates towards the target
+	   until it needs every remaining degree to stop
+	   (v^2 / 2a), then decelerates onto it.
+	*/
+
+	double dt = dT / 1000.0;
+	double distance = target - setpoint;
+	double direction = distance > 0 ? 1 : -1;
+	double stopping =
+		setpoint_velocity * setpoint_velocity / (2 * acceleration);
+
+	if(fabs(distance) <= stopping ||
+	   setpoint_velocity * direction > max_velocity)
+	{
+		double slower = fabs(setpoint_velocity) - acceleration * dt;
+		setpoint_velocity = (setpoint_velocity > 0 ? 1 : -1) *
+							(slower > 0 ? slower : 0);
+	}
+	else
+	{
+		setpoint_velocity += direction * acceleration * dt;
+		if(fabs(setpoint_velocity) > max_velocity)
+		{
+			setpoint_velocity = direction * max_velocity;
+		}
+	}
+
+	setpoint += setpoint_velocity * dt;
+
+	// land exactly on the target instead of passing it
+	if((target - setpoint) * direction <= 0 ||
+	   (fabs(target - setpoint) < 1 && fabs(setpoint_velocity) < 1))
+	{
+		setpoint = target;
+		setpoint_velocity = 0;
+	}
+}
+
+void ArmController::update()
+{
+	/*
+	   Runs one step of the controller.  Must be
+	   called every dT ms, for example from the
+	   opcontrol() loop.
+
+	   Does nothing while the arm is driven
+	   manually.
+	*/
+
+	if(!active)
+	{
+		return;
+	}
+
+	step_profile();
+
+	double position = arm->get_signed_position();
+	double velocity = get_velocity();
+
+	double power = kG * cos(get_angle()) + kV * setpoint_velocity +
+				   kP * (setpoint - position) +
+				   kD * (setpoint_velocity - velocity);
+
+	if(power > 127)
+	{
+		power = 127;
+	}
+	else if(power < -127)
+	{
+		power = -127;
+	}
+	arm->run((int)power);
+}
+
+bool ArmController::at_target()
+{
+	/*
+	   Returns whether the arm has settled at its
+	   target.
+	*/
+
+	return fabs(target - arm->get_signed_position()) < settle_position &&
+		   fabs(get_velocity()) < settle_velocity;
+}
+
+bool ArmController::move_to(int position, std::uint32_t timeout)
+{
+	/*
+	   Moves the arm to an encoder position and
+	   blocks until it settles there.
+
+	   Returns false if it didn't within the
+	   timeout (ms) or was cancelled.  The arm keeps
+	   holding the target afterwards as long as
+	   update() is called.
+	*/
+
+	cancelled = false;
+	set_target(position);
+
+	std::uint32_t start = pros::millis();
+	std::uint32_t now = start;
+	while(!cancelled && now - start < timeout)
+	{
+		update();
+		if(setpoint == target && at_target())
+		{
+			return true;
+		}
+		pros::Task::delay_until(&now, dT);
+	}
+	return false;
+}
+
+void ArmController::cancel()
+{
+	/*
+	   Makes a move_to() running on another task
+	   return at its next step, leaving update() to
+	   whoever drives the arm next.
+	*/
+
+	cancelled = true;
+}
@@ -0,0 +1,73 @@
+#ifndef ARM_CONTROLLER_HPP
+#define ARM_CONTROLLER_HPP
+
+/*
+	The ArmController class moves an arm MotorGroup
+	to preset heights and holds it there.
+
+	The torque gravity puts on the arm is
+	mass * g * link length * cos(angle), like the
+	default torque function of okapi's
+	FlywheelSimulator, so the arm is given a
+	feedforward of kG * cos(angle) that cancels its
+	weight at any height.  Moves follow a trapezoidal
+	profile and a PD loop corrects what is left, so
+	the arm neither sags nor overshoots and only draws
+	the current it needs to hold up its own weight.
+*/
+
+class ArmController
+{
+	public:
+	ArmController(MotorGroup* arm, double gear_ratio, double rest_angle);
+
+	// configuration
+	void set_gravity(double kG);
+	void set_gains(double kP, double kD, double kV);
+	void set_limits(double max_velocity, double acceleration);
+
+	// control
+	void set_target(int position);
+	void manual(int button_one, int button_two);
+	void update();
+	bool move_to(int position, std::uint32_t timeout);
+	void cancel();
+
+	// state
+	bool at_target();
+	double get_angle();
+
+	static constexpr std::uint32_t dT = 10;
+	// distance (degrees) and speed (degrees / s) counted as arrived
+	static constexpr double settle_position = 10;
+	static constexpr double settle_velocity = 30;
+
+	private:
+	double get_velocity();
+	void step_profile();
+
+	MotorGroup* arm;
+
+	// geometry, motor degrees per arm degree and angle at position 0
+	double gear_ratio;
+	double rest_angle;
+
+	// constants
+	double kG = 0;
+	double kP = 0;
+	double kD = 0;
+	double kV = 0;
+	double max_velocity = 600;
+	double acceleration = 2400;
+
+	// profile setpoint
+	double target = 0;
+	double setpoint = 0;
+	double setpoint_velocity = 0;
+	bool active = false;
+
+	// set by cancel() to end a move_to() running on another task
+	std::atomic<bool> cancelled{ false };
+};
+
+#endif
@@ -0,0 +1,555 @@
+#include "main.h"
+
+#include "auton-script.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+AutonScript::AutonScript()
+{
+	/*
+	   Constructor for auton script.
+
+	   Groups and actions are added before a script
+	   is loaded, the workers are started by start().
+	*/
+
+	for(Worker& worker : workers)
+	{
+		worker.script = this;
+		worker.task = nullptr;
+		worker.instruction = nullptr;
+		worker.busy = false;
+	}
+}
+
+AutonScript::~AutonScript()
+{
+	/*
+	   Destructor for auton script.
+
+	   Stops the worker tasks if they were started.
+	*/
+
+	for(Worker& worker : workers)
+	{
+		if(worker.task != nullptr)
+		{
+			worker.task->remove();
+			delete worker.task;
+		}
+	}
+}
+
+void AutonScript::add_group(const char* name, MotorGroup* group)
+{
+	/*
+	   Makes a motor group available to scripts
+	   under the given name, for run, stop, move,
+	   turn and the waits on it.
+
+	   Up to max_groups groups can be added, the
+	   rest are ignored.
+	*/
+
+	if(group_count < max_groups)
+	{
+		group_names[group_count] = name;
+		groups[group_count++] = group;
+	}
+}
+
+void AutonScript::add_action(const char* name, void (*action)(int),
+							 void (*cancel)())
+{
+	/*
+	   Makes a function available to scripts under
+	   the given name.  A script line "name value"
+	   calls it with value, for example to deploy a
+	   stack or move the arm to a preset.
+
+	   cancel, if given, must make a running action
+	   return soon, and is called by stop().
+
+	   Up to max_actions actions can be added, the
+	   rest are ignored.
+	*/
+
+	if(action_count < max_actions)
+	{
+		action_names[action_count] = name;
+		cancels[action_count] = cancel;
+		actions[action_count++] = action;
+	}
+}
+
+void AutonScript::set_monitor(SensorMonitor* monitor)
+{
+	/*
+	   Sets the monitor that reach, speed and stall
+	   wait on.  It must sample every group they
+	   name, scripts using them don't load without
+	   one.
+	*/
+
+	this->monitor = monitor;
+}
+
+void AutonScript::start()
+{
+	/*
+	   Starts the worker tasks that run the
+	   instructions of parallel blocks.
+	*/
+
+	for(Worker& worker : workers)
+	{
+		if(worker.task == nullptr)
+		{
+			worker.busy = false;
+			worker.task =
+				new pros::Task(worker_function, &worker, TASK_PRIORITY_DEFAULT,
+							   TASK_STACK_DEPTH_DEFAULT, "script worker");
+		}
+	}
+}
+
+void AutonScript::stop()
+{
+	/*
+	   Stops whatever the workers are running and
+	   every group the script uses.
+
+	   Called when driver control starts, since the
+	   workers outlive the autonomous task.  Removing
+	   a worker partway through an instruction would
+	   leave whatever it was running in a half done
+	   state, so the workers are cancelled and
+	   waited for, at most stop_timeout ms.  The
+	   cancel is repeated while waiting in case a
+	   worker was just starting a move.
+	*/
+
+	cancelled = true;
+
+	std::uint32_t start = pros::millis();
+	do
+	{
+		cancel_workers();
+		if(!workers_busy())
+		{
+			break;
+		}
+		pros::delay(10);
+	} while(pros::millis() - start < stop_timeout);
+
+	for(std::size_t i = 0; i < target_count; i++)
+	{
+		if(targets[i].group != nullptr)
+		{
+			targets[i].group->stop();
+		}
+	}
+}
+
+void AutonScript::cancel_workers()
+{
+	/*
+	   Ends the PID moves of every group, the
+	   actions of the script that can be cancelled
+	   and the waits on the monitor.
+	*/
+
+	if(monitor != nullptr)
+	{
+		monitor->cancel_waits();
+	}
+
+	for(std::size_t i = 0; i < target_count; i++)
+	{
+		if(targets[i].group != nullptr)
+		{
+			targets[i].group->cancel_pid();
+		}
+		else if(targets[i].cancel != nullptr)
+		{
+			targets[i].cancel();
+		}
+	}
+}
+
+bool AutonScript::workers_busy()
+{
+	/*
+	   Returns true while any worker is running an
+	   instruction.
+	*/
+
+	for(Worker& worker : workers)
+	{
+		if(worker.busy)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool AutonScript::load(const char* path)
+{
+	/*
+	   Loads a compiled script, for example from
+	   "/usd/stack.bin".
+
+	   Returns false and leaves no script loaded if
+	   the file is missing, malformed or uses a name
+	   that was not added.
+	*/
+
+	instruction_count = 0;
+	target_count = 0;
+
+	std::uint8_t data[script::header_size +
+					  script::max_names * script::name_length +
+					  script::max_instructions * script::instruction_size];
+	std::FILE* file = std::fopen(path, "rb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	std::size_t size = std::fread(data, 1, sizeof(data), file);
+	std::fclose(file);
+
+	// header
+	if(size < script::header_size ||
+	   std::memcmp(data, script::magic, sizeof(script::magic)) != 0 ||
+	   data[4] != script::version)
+	{
+		return false;
+	}
+	std::size_t names = data[5];
+	std::size_t count = data[6] | data[7] << 8;
+	if(names > script::max_names || count > script::max_instructions ||
+	   size != script::header_size + names * script::name_length +
+				   count * script::instruction_size)
+	{
+		return false;
+	}
+
+	// names
+	const std::uint8_t* next = data + script::header_size;
+	for(std::size_t i = 0; i < names; i++)
+	{
+		char name[script::name_length + 1] = {};
+		std::memcpy(name, next, script::name_length);
+		next += script::name_length;
+		if(!resolve(name, targets[i]))
+		{
+			return false;
+		}
+	}
+	target_count = names;
+
+	// instructions
+	for(std::size_t i = 0; i < count; i++)
+	{
+		instructions[i].op = static_cast<script::Op>(next[0]);
+		instructions[i].target = next[1];
+		instructions[i].a = static_cast<std::int16_t>(next[2] | next[3] << 8);
+		instructions[i].b = static_cast<std::int16_t>(next[4] | next[5] << 8);
+		next += script::instruction_size;
+	}
+	instruction_count = count;
+
+	if(!check())
+	{
+		instruction_count = 0;
+		return false;
+	}
+	return true;
+}
+
+bool AutonScript::is_loaded()
+{
+	/*
+	   Returns true if a script is ready to run.
+	*/
+
+	return instruction_count > 0;
+}
+
+bool AutonScript::run()
+{
+	/*
+	   Runs the loaded script to the end, blocking
+	   the calling task.
+
+	   Returns false straight away if no script is
+	   loaded, so autonomous can fall back to a
+	   built in routine.
+	*/
+
+	if(instruction_count == 0)
+	{
+		return false;
+	}
+
+	start();
+	cancelled = false;
+
+	for(std::size_t i = 0; i < instruction_count && !cancelled; i++)
+	{
+		const script::Instruction& instruction = instructions[i];
+		if(instruction.op == script::Op::parallel)
+		{
+			run_parallel(&instructions[i + 1], instruction.a);
+			i += instruction.a;
+		}
+		else
+		{
+			execute(instruction);
+		}
+	}
+
+	return true;
+}
+
+void AutonScript::worker_function(void* param)
+{
+	/*
+	   Entry point of a worker task.  Sleeps until
+	   it is handed an instruction and runs it.
+
+	   A worker never notifies the task running the
+	   script, which competition control may have
+	   deleted by the time the worker returns.
+	   run_parallel() watches busy instead.
+	*/
+
+	Worker* worker = static_cast<Worker*>(param);
+
+	while(true)
+	{
+		pros::c::task_notify_take(true, TIMEOUT_MAX);
+
+		const script::Instruction* instruction = worker->instruction;
+		if(instruction != nullptr)
+		{
+			worker->script->execute(*instruction);
+			worker->instruction = nullptr;
+		}
+		worker->busy = false;
+	}
+}
+
+bool AutonScript::resolve(const char* name, Target& target)
+{
+	/*
+	   Finds the group or action added under name.
+	*/
+
+	target = Target{ nullptr, nullptr, nullptr };
+
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		if(std::strcmp(name, group_names[i]) == 0)
+		{
+			target.group = groups[i];
+			return true;
+		}
+	}
+	for(std::size_t i = 0; i < action_count; i++)
+	{
+		if(std::strcmp(name, action_names[i]) == 0)
+		{
+			target.action = actions[i];
+			target.cancel = cancels[i];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool AutonScript::check()
+{
+	/*
+	   Checks every instruction of a loaded script
+	   once, so run() and execute() don't have to.
+
+	   Group instructions need a group, waits on a
+	   group also the monitor, calls an action, and
+	   a parallel block holds between 1 and
+	   max_branches plain instructions that each
+	   drive a different group.
+	*/
+
+	auto uses_group = [](const script::Instruction& instruction) {
+		return instruction.op == script::Op::run ||
+			   instruction.op == script::Op::stop ||
+			   instruction.op == script::Op::move ||
+			   instruction.op == script::Op::turn;
+	};
+
+	for(std::size_t i = 0; i < instruction_count; i++)
+	{
+		const script::Instruction& instruction = instructions[i];
+		bool has_target = instruction.target < target_count;
+
+		switch(instruction.op)
+		{
+			case script::Op::run:
+			case script::Op::stop:
+			case script::Op::move:
+			case script::Op::turn:
+				if(!has_target || targets[instruction.target].group == nullptr)
+				{
+					return false;
+				}
+				break;
+			case script::Op::reach:
+			case script::Op::speed:
+			case script::Op::stall:
+				if(!has_target ||
+				   targets[instruction.target].group == nullptr ||
+				   monitor == nullptr || instruction.b < 0 ||
+				   instruction.op == script::Op::stall && instruction.a < 0)
+				{
+					return false;
+				}
+				break;
+			case script::Op::call:
+				if(!has_target ||
+				   targets[instruction.target].action == nullptr)
+				{
+					return false;
+				}
+				break;
+			case script::Op::wait:
+				if(instruction.a < 0)
+				{
+					return false;
+				}
+				break;
+			case script::Op::parallel:
+			{
+				std::size_t count = instruction.a;
+				if(instruction.a < 1 || count > script::max_branches ||
+				   i + count >= instruction_count)
+				{
+					return false;
+				}
+				for(std::size_t j = i + 1; j <= i + count; j++)
+				{
+					if(instructions[j].op == script::Op::parallel)
+					{
+						return false;
+					}
+					for(std::size_t k = i + 1; k < j; k++)
+					{
+						if(uses_group(instructions[k]) &&
+						   uses_group(instructions[j]) &&
+						   instructions[k].target == instructions[j].target)
+						{
+							return false;
+						}
+					}
+				}
+				break;
+			}
+			default:
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void AutonScript::execute(const script::Instruction& instruction)
+{
+	/*
+	   Runs one instruction on the calling task.
+
+	   Once the script is cancelled nothing more is
+	   started, and a wait ends early.
+	*/
+
+	if(cancelled)
+	{
+		return;
+	}
+
+	const Target& target = targets[instruction.target];
+
+	switch(instruction.op)
+	{
+		case script::Op::run:
+			target.group->run(instruction.a);
+			break;
+		case script::Op::stop:
+			target.group->stop();
+			break;
+		case script::Op::move:
+			target.group->move_pid(instruction.a, instruction.b);
+			break;
+		case script::Op::turn:
+			target.group->turn_pid(instruction.a, instruction.b);
+			break;
+		case script::Op::call:
+			target.action(instruction.a);
+			break;
+		case script::Op::wait:
+		{
+			// in short steps so a cancel ends it
+			std::uint32_t now = pros::millis();
+			std::uint32_t end = now + instruction.a;
+			while(!cancelled && now < end)
+			{
+				pros::delay(std::min<std::uint32_t>(10, end - now));
+				now = pros::millis();
+			}
+			break;
+		}
+		case script::Op::reach:
+			monitor->wait_until_position(target.group, instruction.a,
+										 instruction.b);
+			break;
+		case script::Op::speed:
+			monitor->wait_until_velocity(target.group, instruction.a,
+										 instruction.b);
+			break;
+		case script::Op::stall:
+			monitor->wait_until_stall(target.group, instruction.a);
+			break;
+		default:
+			break;
+	}
+}
+
+void AutonScript::run_parallel(const script::Instruction* branches,
+							   std::size_t count)
+{
+	/*
+	   Hands all but the last branch to the workers,
+	   runs the last one on the calling task and
+	   waits until every worker is done.
+	*/
+
+	for(std::size_t i = 0; i + 1 < count; i++)
+	{
+		workers[i].busy = true;
+		workers[i].instruction = &branches[i];
+		workers[i].task->notify();
+	}
+
+	execute(branches[count - 1]);
+
+	for(std::size_t i = 0; i + 1 < count; i++)
+	{
+		while(workers[i].busy)
+		{
+			pros::delay(1);
+		}
+	}
+}
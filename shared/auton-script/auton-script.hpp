@@ -0,0 +1,99 @@
+#ifndef AUTON_SCRIPT_HPP
+#define AUTON_SCRIPT_HPP
+
+/*
+	The AutonScript class runs autonomous routines
+	compiled from text scripts (see script-format.hpp
+	and host/script-compile.cpp) and loaded from the
+	sd card, so a routine can be changed without
+	building and uploading the program again.
+
+	Everything is checked and every name resolved to
+	a motor group or an action when the script is
+	loaded, so running an instruction is a single
+	switch with no lookups.  A parallel block hands
+	its instructions to a pool of worker tasks and
+	waits for all of them to finish.
+
+	stop() never removes a worker partway through an
+	instruction.  It cancels what the workers are
+	running (a PID move, an action with a cancel
+	function, a wait) and lets them return.
+
+	Waits on a group's position, speed or a stall
+	sleep in the SensorMonitor given to
+	set_monitor(), which samples the groups the
+	script uses.
+*/
+
+class AutonScript
+{
+	public:
+	AutonScript();
+	~AutonScript();
+
+	// names used by scripts
+	void add_group(const char* name, MotorGroup* group);
+	void add_action(const char* name, void (*action)(int),
+					void (*cancel)() = nullptr);
+	void set_monitor(SensorMonitor* monitor);
+
+	// task control
+	void start();
+	void stop();
+
+	// scripts
+	bool load(const char* path);
+	bool is_loaded();
+	bool run();
+
+	static constexpr std::size_t max_groups = 8;
+	static constexpr std::size_t max_actions = 8;
+	static constexpr std::size_t max_workers = script::max_branches - 1;
+	// ms stop() waits for the workers to return
+	static constexpr std::uint32_t stop_timeout = 500;
+
+	private:
+	struct Target
+	{
+		MotorGroup* group;
+		void (*action)(int);
+		void (*cancel)();
+	};
+
+	struct Worker
+	{
+		AutonScript* script;
+		pros::Task* task;
+		std::atomic<const script::Instruction*> instruction;
+		std::atomic<bool> busy;
+	};
+
+	static void worker_function(void* param);
+	bool resolve(const char* name, Target& target);
+	bool check();
+	void execute(const script::Instruction& instruction);
+	void cancel_workers();
+	bool workers_busy();
+	void run_parallel(const script::Instruction* branches,
+					  std::size_t count);
+
+	const char* group_names[max_groups];
+	MotorGroup* groups[max_groups];
+	std::size_t group_count = 0;
+	const char* action_names[max_actions];
+	void (*actions[max_actions])(int);
+	void (*cancels[max_actions])();
+	std::size_t action_count = 0;
+
+	Target targets[script::max_names];
+	std::size_t target_count = 0;
+	script::Instruction instructions[script::max_instructions];
+	std::size_t instruction_count = 0;
+
+	SensorMonitor* monitor = nullptr;
+	Worker workers[max_workers];
+	std::atomic<bool> cancelled{ false };
+};
+
+#endif
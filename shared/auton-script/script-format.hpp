@@ -0,0 +1,61 @@
+#ifndef SCRIPT_FORMAT_HPP
+#define SCRIPT_FORMAT_HPP
+
+/*
+	Layout of a compiled autonomous script, shared by
+	the AutonScript interpreter on the robot and the
+	script compiler on the host.
+
+	All values are little endian.
+
+	  header        magic "ASCR", version, name count,
+	                instruction count (16 bit)
+	  names         name_count names of name_length
+	                bytes, zero padded
+	  instructions  instruction_count instructions of
+	                instruction_size bytes: op, target,
+	                then a and b (signed 16 bit)
+
+	The target of an instruction is an index into the
+	names, resolved to a motor group or an action once
+	when the script is loaded.
+*/
+
+namespace script
+{
+constexpr char magic[4] = { 'A', 'S', 'C', 'R' };
+constexpr std::uint8_t version = 1;
+
+constexpr std::size_t header_size = 8;
+constexpr std::size_t name_length = 16;
+constexpr std::size_t instruction_size = 6;
+
+constexpr std::size_t max_names = 16;
+constexpr std::size_t max_instructions = 256;
+// instructions one parallel block can run at the same time
+constexpr std::size_t max_branches = 4;
+
+enum class Op : std::uint8_t
+{
+	run,	  // group runs at speed a
+	stop,	  // group stops
+	move,	  // group moves a ticks, at most speed b
+	turn,	  // group turns a ticks, at most speed b
+	call,	  // action is called with a
+	wait,	  // waits a ms
+	parallel, // the next a instructions run at the same time
+	reach,	  // waits until group reaches position a, at most b ms
+	speed,	  // waits until group reaches a rpm, at most b ms
+	stall	  // waits until group stalls, at most a ms
+};
+
+struct Instruction
+{
+	Op op;
+	std::uint8_t target;
+	std::int16_t a;
+	std::int16_t b;
+};
+} // namespace script
+
+#endif
@@ -1,9 +1,13 @@
 #!/bin/bash
 
+# shared code is compiled once into library/bin/libshared.a,
+# make only rebuilds the files that changed since the last run
+echo "Compiling @ library/"
+make -C library -j library
+
 for d in projects/*/ ; do
 	echo "Compiling @ $d"
 	cd $d
-	make -j clean
 	make -j
 	cd ..
 	cd ..
@@ -7,6 +7,9 @@
 
 pros::Controller master(pros::E_CONTROLLER_MASTER);
 
+// queued screen and rumble output for the master controller
+ControllerOutput master_output(&master);
+
 // left drive is normal direction
 pros::Motor left_drive(1, false);
 // right drive is reversed direction
@@ -39,6 +42,90 @@ pros::Motor right_arm(6, false);
 // motor group based off of ports [5, 6]
 MotorGroup arm({ &left_arm, &right_arm }, { 60, -40 });
 
+// current budget (mA) shared by all eight motors
+PowerManager power(16000);
+
+// predicts motor derating and eases groups off ahead of it
+ThermalModel thermal;
+
+// a full motor output is 11V, which the battery holds through a match
+VoltageCompensator compensator(11000);
+
+// samples the groups and wakes tasks waiting on them
+SensorMonitor sensors;
+
+// inertial sensor, calibrated by the warm up
+pros::Imu imu(10);
+
+// field position from the drive encoders and the inertial sensor
+PoseFilter pose(&left_drive, &right_drive, &imu, 4, 12.5);
+
+// vision sensor with the cubes as signature 1
+pros::Vision vision_sensor(8);
+
+// tracks the nearest cube for the drive assist, cubes are 5.5in across
+VisionTracker vision(&vision_sensor, 1, 5.5);
+
+// one motion ramp deploy for stacking
+StackDeploy deploy(&ramp, &scooper);
+
+// arm presets (motor degrees) for the towers
+constexpr int ARM_STOW = 0;
+constexpr int ARM_LOW_TOWER = 1300;
+constexpr int ARM_MID_TOWER = 1750;
+
+// arm geared 7:1, resting 40 degrees below horizontal
+ArmController arm_control(&arm, 7.0, -40.0);
+
+// port checks and precomputation while the robot is disabled
+WarmUp warm_up;
+
+// autonomous routines compiled on the host and read from the sd card
+AutonScript auton_script;
+
+// driver runs recorded with y and replayed as routines
+InputRecorder recorder(&master);
+
+// the drive's PID moves in autonomous, saved for replay on the host
+MotionLog drive_log;
+
+const char* const routines[] = { "/usd/stack.bin", "/usd/skills.rec" };
+constexpr std::size_t routine_count = sizeof(routines) / sizeof(routines[0]);
+std::size_t routine = 0;
+
+void load_routine()
+{
+	/*
+	   reads the selected routine, a script or a
+	   recording, autonomous falls back to the built
+	   in one if it can't be loaded
+	*/
+	auton_script.load(routines[routine]);
+	recorder.load(routines[routine]);
+}
+
+void deploy_action(int timeout)
+{
+	// 0 leaves the timeout to the profile
+	deploy.run(timeout > 0 ? timeout : deploy.get_timeout());
+}
+
+void arm_action(int position)
+{
+	arm_control.move_to(position, 2000);
+}
+
+// make the actions above return when the script is stopped
+void deploy_cancel()
+{
+	deploy.cancel();
+}
+
+void arm_cancel()
+{
+	arm_control.cancel();
+}
+
 void initialize()
 {
 	/*
@@ -50,18 +137,134 @@ void initialize()
 
 	// initializes hardware
 	pros::lcd::initialize();
+	master_output.start();
 
 	// user initialization
 	ramp.set_brake(BRAKE);
 	/*
 	   slowing down the ramp towards the end,
-	   this allows for easier stacking.
+	   this allows for easier stacking.  The ramp
+	   eases from full speed into the stacking speed
+	   instead of stepping down at 1500.
 	*/
+	ramp.add_speed_point(1000, { 80, -60 });
+	ramp.add_speed_point(1500, { 35, -60 });
+	ramp.add_speed_point(2500, { 35, -60 });
+	ramp.add_speed_point(2501, { 80, -60 });
 	arm.set_brake(BRAKE);
-	ramp.set_threshold(1500, 2500, { 35, -60 });
+
+	// keep both sides of the paired mechanisms together
+	ramp.set_sync(0.5);
+	arm.set_sync(0.5);
+	scooper.set_sync(0.2);
+
+	/*
+	   the deploy rushes through the empty part of the
+	   ramp's travel, crawls through the stacking range
+	   just under the 47rpm holding x gets there and
+	   lets the stack go with the scooper at the top.
+	*/
+	deploy.set_profile(3000, 1500, 2500, 150, 45, 600);
+	deploy.set_gains(127.0 / 200.0, 2);
+	deploy.set_outtake(2500, 3000, -40);
+	deploy.start_task();
+
+	arm_control.set_gravity(18);
+	arm_control.set_gains(0.3, 0.05, 127.0 / 1200.0);
+	arm_control.set_limits(900, 3000);
+
+	// smoothed velocity for the D terms and the deploy's velocity loop,
+	// dema follows the drive's ramps
+	drive.set_velocity_filter(VelocityFilter::dema, 0.5, 0.3);
+	arm.set_velocity_filter(VelocityFilter::ema, 0.6);
+	ramp.set_velocity_filter(VelocityFilter::ema, 0.5);
 
 	drive.set_pid_constants(0.25, 0.10, 5.0);
 	drive.set_pid_turn_constants(0.40, 0.10, 1.0);
+	drive.set_log(&drive_log);
+
+	/*
+	   the drive is served first, the arm and scooper
+	   share whatever current is left over.
+	*/
+	power.add_group(&drive, 2);
+	power.add_group(&ramp, 2);
+	power.add_group(&scooper, 1);
+	power.add_group(&arm, 1);
+	power.start();
+
+	thermal.add_group(&drive);
+	thermal.add_group(&ramp);
+	thermal.add_group(&scooper);
+	thermal.add_group(&arm);
+	thermal.start();
+
+	compensator.start();
+
+	sensors.add_group(&drive);
+	sensors.add_group(&ramp);
+	sensors.add_group(&scooper);
+	sensors.add_group(&arm);
+	sensors.start();
+
+	pose.start();
+	vision.start();
+
+	auton_script.add_group("drive", &drive);
+	auton_script.add_group("ramp", &ramp);
+	auton_script.add_group("scooper", &scooper);
+	auton_script.add_group("arm", &arm);
+	auton_script.add_action("deploy", deploy_action, deploy_cancel);
+	auton_script.add_action("arm_to", arm_action, arm_cancel);
+	auton_script.set_monitor(&sensors);
+	auton_script.start();
+
+	// the routine is read from the sd card off the control loops
+	warm_up.add_group(&drive);
+	warm_up.add_group(&ramp);
+	warm_up.add_group(&scooper);
+	warm_up.add_group(&arm);
+	warm_up.add_imu(&imu);
+	warm_up.add_stage(load_routine);
+	warm_up.start();
+}
+
+void show_warm_up()
+{
+	/*
+	   Shows the warm up on the controller and lets
+	   the lcd's left and right buttons pick the
+	   routine, until the robot is enabled and this
+	   task ends.
+	*/
+
+	std::uint8_t last_buttons = 0;
+	while(true)
+	{
+		std::uint8_t buttons = pros::lcd::read_buttons();
+		std::uint8_t pressed = buttons & ~last_buttons;
+		last_buttons = buttons;
+		if(pressed & (LCD_BTN_LEFT | LCD_BTN_RIGHT))
+		{
+			std::size_t step = pressed & LCD_BTN_RIGHT ? 1 : routine_count - 1;
+			routine = (routine + step) % routine_count;
+			load_routine();
+		}
+		bool loaded = auton_script.is_loaded() || recorder.is_loaded();
+		pros::lcd::print(0, "%s %s", routines[routine],
+						 loaded ? "loaded" : "missing");
+
+		if(warm_up.get_fault_count() > 0)
+		{
+			master_output.print(2, "port %u fault", warm_up.get_faulty_port());
+		}
+		else
+		{
+			master_output.print(2, warm_up.is_ready() ? "ready" : "warming up");
+		}
+
+		pros::delay(100);
+	}
 }
 
 void competition_initialize()
@@ -71,6 +274,20 @@ void competition_initialize()
 
 	   Useful for picking autonomous programs on the lcd.
 	*/
+
+	show_warm_up();
+}
+
+void save_drive_log()
+{
+	/*
+	   writes the moves autonomous recorded once it
+	   is over, for motion-replay on the host
+	*/
+	if(drive_log.is_recording())
+	{
+		drive_log.stop_recording("/usd/motion.log");
+	}
 }
 
 void disabled()
@@ -80,23 +297,229 @@ void disabled()
 
 	   Useful when encoders or sensor values must be set
 	*/
+
+	save_drive_log();
+	show_warm_up();
 }
 
-void opcontrol()
+// whether the power manager is favouring the drive for a sprint
+bool sprinting = false;
+
+void drive_input(const ControllerSnapshot& input)
 {
-	while(true)
+	// control drive train with joysticks, holding left steers onto a cube
+	int left = input.get_analog(JOY_LY);
+	int right = input.get_analog(JOY_RY);
+	if(!input.get_digital(LEFT) || !vision.assist(&drive, (left + right) / 2))
+	{
+		drive.run({ left, right });
+	}
+
+	// favour the drive over everything else while sprinting
+	bool sprint = abs(left) > 110 && abs(right) > 110;
+	if(sprint != sprinting)
+	{
+		power.set_priority(&drive, sprint ? 3 : 2);
+		sprinting = sprint;
+	}
+}
+
+void ramp_input(const ControllerSnapshot& input)
+{
+	/*
+	   a button deploys the stack, x or b cancels it.
+	   The deploy task drives the ramp and the
+	   scooper while it runs, so this and
+	   scooper_input() leave them alone until it is
+	   done
+	*/
+	if(input.get_digital_new_press(A) && warm_up.is_ready())
 	{
-		// control drive train with joysticks
-		drive.run({ master.get_analog(JOY_LY), master.get_analog(JOY_RY) });
+		deploy.trigger(deploy.get_timeout());
+	}
 
+	if(deploy.is_running())
+	{
+		if(input.get_digital(X) || input.get_digital(B))
+		{
+			deploy.cancel();
+		}
+	}
+	else
+	{
 		// control ramp based off of x and b button
-		ramp.run(master.get_digital(X), master.get_digital(B));
-		// control arm based off of left index finger controls
-		arm.run(master.get_digital(L_BUMPER), master.get_digital(L_TRIGGER));
-		// control scooper based off of right index finger controls
-		scooper.run(master.get_digital(R_BUMPER),
-					master.get_digital(R_TRIGGER));
-
-		pros::delay(10);
+		ramp.run(input.get_digital(X), input.get_digital(B));
+	}
+}
+
+void scooper_input(const ControllerSnapshot& input)
+{
+	// control scooper based off of right index finger controls
+	if(!deploy.is_running())
+	{
+		scooper.run(input.get_digital(R_BUMPER), input.get_digital(R_TRIGGER));
+	}
+}
+
+void arm_input(const ControllerSnapshot& input)
+{
+	// arm presets on the d-pad
+	if(input.get_digital_new_press(UP))
+	{
+		arm_control.set_target(ARM_MID_TOWER);
+	}
+	else if(input.get_digital_new_press(RIGHT))
+	{
+		arm_control.set_target(ARM_LOW_TOWER);
+	}
+	else if(input.get_digital_new_press(DOWN))
+	{
+		arm_control.set_target(ARM_STOW);
+	}
+
+	// control arm based off of left index finger controls
+	arm_control.manual(input.get_digital(L_BUMPER),
+					   input.get_digital(L_TRIGGER));
+	arm_control.update();
+}
+
+/*
+   driver control of each mechanism runs on its own
+   task, set subsystem_tasks to false before driver
+   control starts to run them one after another in
+   the control loop and compare the latency on the
+   lcd (host/sim-check latency does both)
+*/
+bool subsystem_tasks = true;
+Subsystem drive_subsystem("drive", &drive, drive_input);
+Subsystem ramp_subsystem("ramp", &ramp, ramp_input);
+Subsystem scooper_subsystem("scooper", &scooper, scooper_input);
+Subsystem arm_subsystem("arm", &arm, arm_input);
+Subsystem* const subsystems[] = { &drive_subsystem, &ramp_subsystem,
+								  &scooper_subsystem, &arm_subsystem };
+
+void start_subsystems()
+{
+	/*
+	   the drive reacts first, the scooper last
+	*/
+	if(subsystem_tasks)
+	{
+		drive_subsystem.start(TASK_PRIORITY_DEFAULT + 3);
+		ramp_subsystem.start(TASK_PRIORITY_DEFAULT + 2);
+		arm_subsystem.start(TASK_PRIORITY_DEFAULT + 2);
+		scooper_subsystem.start(TASK_PRIORITY_DEFAULT + 1);
+	}
+}
+
+void show_latency()
+{
+	/*
+	   input to motor latency of each subsystem on
+	   the lcd, below the routine
+	*/
+	for(std::size_t i = 0; i < sizeof(subsystems) / sizeof(subsystems[0]);
+		i++)
+	{
+		Subsystem* subsystem = subsystems[i];
+		pros::lcd::print(i + 2, "%-8s %5.2fms max %5.2fms",
+						 subsystem->get_name(),
+						 subsystem->get_average_latency(),
+						 subsystem->get_max_latency());
+	}
+}
+
+void drive_tick(const ControllerSnapshot& input)
+{
+	/*
+	   one tick of driver control, from the live
+	   controller or from a recording
+	*/
+
+	std::uint64_t time = Subsystem::get_time();
+	for(Subsystem* subsystem : subsystems)
+	{
+		subsystem->post(input, time);
+	}
+
+	// driver info, sent by the output task so this loop never waits
+	master_output.print(0, "ramp %u", ramp.get_average_position());
+	master_output.print(1, "batt %.0f%% %.0fC", pros::battery::get_capacity(),
+						power.get_max_temperature());
+}
+
+bool replay_routine()
+{
+	/*
+	   Replays the loaded recording through the same
+	   code as driver control, at the tick it was
+	   recorded at.
+
+	   Returns false if no recording is loaded.
+	*/
+
+	if(!recorder.is_loaded())
+	{
+		return false;
+	}
+
+	recorder.rewind();
+	ControllerSnapshot input;
+	std::uint32_t now = pros::millis();
+	while(recorder.next(input))
+	{
+		drive_tick(input);
+		pros::Task::delay_until(&now, InputRecorder::tick_interval);
+	}
+
+	// let go of every stick and button
+	drive_tick(ControllerSnapshot{ {}, 0, 0 });
+	return true;
+}
+
+void opcontrol()
+{
+	// parallel blocks of the routine may still be running
+	auton_script.stop();
+	deploy.cancel();
+	save_drive_log();
+
+	start_subsystems();
+
+	std::uint32_t now = pros::millis();
+	for(std::uint32_t tick = 0;; tick++)
+	{
+		ControllerSnapshot input = recorder.read();
+
+		// y starts and stops recording a run for autonomous
+		if(input.get_digital_new_press(Y))
+		{
+			if(recorder.is_recording())
+			{
+				// a run too long for the recorder is saved cut short
+				if(recorder.stop_recording("/usd/skills.rec"))
+				{
+					master_output.rumble("--");
+				}
+				else
+				{
+					master_output.rumble(recorder.is_full() ? "-.." : "...");
+				}
+			}
+			else
+			{
+				recorder.start_recording();
+				master_output.rumble(".");
+			}
+		}
+
+		drive_tick(input);
+
+		if(tick % 50 == 0)
+		{
+			show_latency();
+		}
+
+		pros::Task::delay_until(&now, InputRecorder::tick_interval);
 	}
 }
@@ -42,8 +42,28 @@
 //#include "okapi/api.hpp"
 //#include "pros/api_legacy.h"
 
+#include <atomic>
+
 #include "macros.hpp"
+#include "speed-map.hpp"
+#include "velocity-estimator.hpp"
+#include "filter-bank.hpp"
+#include "motion-log.hpp"
 #include "motor-group.hpp"
+#include "controller-output.hpp"
+#include "power-manager.hpp"
+#include "thermal-model.hpp"
+#include "voltage-compensator.hpp"
+#include "sensor-monitor.hpp"
+#include "pose-filter.hpp"
+#include "vision-tracker.hpp"
+#include "stack-deploy.hpp"
+#include "arm-controller.hpp"
+#include "warm-up.hpp"
+#include "script-format.hpp"
+#include "auton-script.hpp"
+#include "input-recorder.hpp"
+#include "subsystem.hpp"
 
 /**
  * If you find doing pros::Motor() to be tedious and you'd prefer just to do
@@ -77,6 +97,30 @@ extern "C"
 	extern MotorGroup arm;
 	extern MotorGroup ramp;
 	extern pros::Controller master;
+	extern ControllerOutput master_output;
+	extern PowerManager power;
+	extern ThermalModel thermal;
+	extern VoltageCompensator compensator;
+	extern SensorMonitor sensors;
+	extern pros::Imu imu;
+	extern PoseFilter pose;
+	extern pros::Vision vision_sensor;
+	extern VisionTracker vision;
+	extern StackDeploy deploy;
+	extern ArmController arm_control;
+	extern WarmUp warm_up;
+	extern AutonScript auton_script;
+	extern InputRecorder recorder;
+	extern MotionLog drive_log;
+	extern bool subsystem_tasks;
+	extern Subsystem drive_subsystem;
+	extern Subsystem ramp_subsystem;
+	extern Subsystem scooper_subsystem;
+	extern Subsystem arm_subsystem;
+
+	bool replay_routine(void);
+	void start_subsystems(void);
+	void drive_tick(const ControllerSnapshot& input);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,215 @@
+#include "main.h"
+
+#include "controller-output.hpp"
+
+#include <cstdarg>
+#include <cstring>
+
+ControllerOutput::ControllerOutput(pros::Controller* controller)
+{
+	/*
+	   Constructor for controller output.  Takes the
+	   controller that all queued output is sent to.
+
+	   Nothing is sent until start() is called.
+	*/
+
+	this->controller = controller;
+
+	for(std::uint8_t i = 0; i < line_count; i++)
+	{
+		lines[i][0] = '\0';
+		shown[i][0] = '\0';
+		dirty[i] = false;
+	}
+	rumble_pattern[0] = '\0';
+}
+
+ControllerOutput::~ControllerOutput()
+{
+	/*
+	   Destructor for controller output.
+
+	   Stops the output task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void ControllerOutput::start()
+{
+	/*
+	   Starts the task that sends queued output to
+	   the controller.
+
+	   Must be called after the kernel is running
+	   (from initialize() or later).  Calling it more
+	   than once has no effect.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT - 2,
+						  TASK_STACK_DEPTH_DEFAULT, "controller output");
+}
+
+void ControllerOutput::print(std::uint8_t line, const char* fmt, ...)
+{
+	/*
+	   Formats text like printf and queues it for
+	   the given line.
+
+	   Only formats into a small buffer, so it is
+	   cheap enough to call every loop.
+	*/
+
+	char text[line_width + 1];
+
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(text, sizeof(text), fmt, args);
+	va_end(args);
+
+	set_line(line, text);
+}
+
+void ControllerOutput::set_line(std::uint8_t line, const char* text)
+{
+	/*
+	   Queues text for the given line.
+
+	   Replaces any text for that line that has not
+	   been sent yet.  Text is padded with spaces so
+	   it overwrites everything previously shown.
+	*/
+
+	if(line >= line_count)
+	{
+		return;
+	}
+
+	char padded[line_width + 1];
+	snprintf(padded, sizeof(padded), "%-15s", text);
+
+	mutex.take(TIMEOUT_MAX);
+	strcpy(lines[line], padded);
+	dirty[line] = strcmp(lines[line], shown[line]) != 0;
+	mutex.give();
+}
+
+void ControllerOutput::clear_line(std::uint8_t line)
+{
+	/*
+	   Queues a blank line.
+
+	   Equivalent to set_line(line, "").
+	*/
+
+	set_line(line, "");
+}
+
+void ControllerOutput::rumble(const char* pattern)
+{
+	/*
+	   Queues a rumble pattern ('.' short, '-' long
+	   and ' ' pause, up to 8 characters).
+
+	   A rumble is sent before any pending text and
+	   replaces a rumble that has not been sent yet.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	strncpy(rumble_pattern, pattern, sizeof(rumble_pattern) - 1);
+	rumble_pattern[sizeof(rumble_pattern) - 1] = '\0';
+	rumble_pending = true;
+	mutex.give();
+}
+
+void ControllerOutput::task_function(void* param)
+{
+	/*
+	   Entry point of the output task.
+
+	   Sends at most one request per update interval,
+	   which is the fastest the controller accepts.
+	*/
+
+	ControllerOutput* output = static_cast<ControllerOutput*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		output->send_next();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void ControllerOutput::send_next()
+{
+	/*
+	   Sends the next queued request.
+
+	   A pending rumble goes first, then the changed
+	   lines in turn so a line that updates every loop
+	   cannot starve the others.  The mutex is only
+	   held while copying, never during the slow write.
+	*/
+
+	char text[line_width + 1];
+	char pattern[sizeof(rumble_pattern)];
+	int line = -1;
+	bool send_rumble = false;
+
+	mutex.take(TIMEOUT_MAX);
+	if(rumble_pending)
+	{
+		strcpy(pattern, rumble_pattern);
+		rumble_pending = false;
+		send_rumble = true;
+	}
+	else
+	{
+		for(std::uint8_t i = 0; i < line_count; i++)
+		{
+			std::uint8_t idx = (next_line + i) % line_count;
+			if(dirty[idx])
+			{
+				line = idx;
+				strcpy(text, lines[idx]);
+				dirty[idx] = false;
+				next_line = (idx + 1) % line_count;
+				break;
+			}
+		}
+	}
+	mutex.give();
+
+	if(send_rumble)
+	{
+		controller->rumble(pattern);
+	}
+	else if(line >= 0)
+	{
+		if(controller->set_text(line, 0, text) == 1)
+		{
+			mutex.take(TIMEOUT_MAX);
+			strcpy(shown[line], text);
+			dirty[line] = strcmp(lines[line], shown[line]) != 0;
+			mutex.give();
+		}
+		else
+		{
+			// write was rejected, try again on a later update
+			mutex.take(TIMEOUT_MAX);
+			dirty[line] = strcmp(lines[line], shown[line]) != 0;
+			mutex.give();
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef CONTROLLER_OUTPUT_HPP
+#define CONTROLLER_OUTPUT_HPP
+
+/*
+	The ControllerOutput class queues text and rumble
+	requests for a pros::Controller and sends them from
+	its own task.
+
+	Writing to the controller goes over the radio and
+	is only accepted every 50ms, so calling it from the
+	control loop would stall the loop.  Instead each
+	line keeps only its newest text (older, unsent text
+	is dropped) and the task sends one change at a time
+	at the rate the controller allows.
+*/
+
+class ControllerOutput
+{
+	public:
+	ControllerOutput(pros::Controller* controller);
+	~ControllerOutput();
+
+	// task control
+	void start();
+
+	// queued output
+	void print(std::uint8_t line, const char* fmt, ...);
+	void set_line(std::uint8_t line, const char* text);
+	void clear_line(std::uint8_t line);
+	void rumble(const char* pattern);
+
+	static constexpr std::uint8_t line_count = 3;
+	static constexpr std::uint8_t line_width = 15;
+	static constexpr std::uint32_t update_interval = 50;
+
+	private:
+	static void task_function(void* param);
+	void send_next();
+
+	pros::Controller* controller;
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+
+	// newest requested text and the text currently on screen
+	char lines[line_count][line_width + 1];
+	char shown[line_count][line_width + 1];
+	bool dirty[line_count];
+	std::uint8_t next_line = 0;
+
+	char rumble_pattern[9];
+	bool rumble_pending = false;
+};
+
+#endif
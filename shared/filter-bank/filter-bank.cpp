@@ -0,0 +1,454 @@
+#include "main.h"
+
+#include "filter-bank.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+namespace
+{
+/*
+   four channels at a time, NEON on the brain, SSE on
+   a desktop and plain loops anywhere else.  gcc
+   already has + - * for the NEON and SSE types.
+*/
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+typedef float32x4_t Vector;
+
+inline Vector load(const float* values)
+{
+	return vld1q_f32(values);
+}
+
+inline void store(float* values, Vector vector)
+{
+	vst1q_f32(values, vector);
+}
+
+inline Vector splat(float value)
+{
+	return vdupq_n_f32(value);
+}
+
+inline Vector min(Vector left, Vector right)
+{
+	return vminq_f32(left, right);
+}
+
+inline Vector max(Vector left, Vector right)
+{
+	return vmaxq_f32(left, right);
+}
+#elif defined(__SSE__)
+typedef __m128 Vector;
+
+inline Vector load(const float* values)
+{
+	return _mm_load_ps(values);
+}
+
+inline void store(float* values, Vector vector)
+{
+	_mm_store_ps(values, vector);
+}
+
+inline Vector splat(float value)
+{
+	return _mm_set1_ps(value);
+}
+
+inline Vector min(Vector left, Vector right)
+{
+	return _mm_min_ps(left, right);
+}
+
+inline Vector max(Vector left, Vector right)
+{
+	return _mm_max_ps(left, right);
+}
+#else
+struct Vector
+{
+	float lane[4];
+};
+
+inline Vector load(const float* values)
+{
+	return Vector{ { values[0], values[1], values[2], values[3] } };
+}
+
+inline void store(float* values, Vector vector)
+{
+	for(int i = 0; i < 4; i++)
+	{
+		values[i] = vector.lane[i];
+	}
+}
+
+inline Vector splat(float value)
+{
+	return Vector{ { value, value, value, value } };
+}
+
+template<typename Operation>
+inline Vector lanes(Vector left, Vector right, Operation operation)
+{
+	Vector result;
+	for(int i = 0; i < 4; i++)
+	{
+		result.lane[i] = operation(left.lane[i], right.lane[i]);
+	}
+	return result;
+}
+
+inline Vector operator+(Vector left, Vector right)
+{
+	return lanes(left, right, [](float x, float y) { return x + y; });
+}
+
+inline Vector operator-(Vector left, Vector right)
+{
+	return lanes(left, right, [](float x, float y) { return x - y; });
+}
+
+inline Vector operator*(Vector left, Vector right)
+{
+	return lanes(left, right, [](float x, float y) { return x * y; });
+}
+
+inline Vector min(Vector left, Vector right)
+{
+	return lanes(left, right, [](float x, float y) { return x < y ? x : y; });
+}
+
+inline Vector max(Vector left, Vector right)
+{
+	return lanes(left, right, [](float x, float y) { return x > y ? x : y; });
+}
+#endif
+
+constexpr std::size_t lanes_per_vector = 4;
+
+inline void sort_pair(Vector& low, Vector& high)
+{
+	/*
+	   one compare and swap of a sorting network,
+	   in every lane at once
+	*/
+	Vector smaller = min(low, high);
+	high = max(low, high);
+	low = smaller;
+}
+} // namespace
+
+FilterBank::FilterBank(std::size_t channels)
+{
+	/*
+	   Constructor for filter bank.
+
+	   Up to max_channels channels, the rest are
+	   ignored.  Starts as a pass through until a
+	   filter is set.
+	*/
+
+	channel_count = channels < max_channels ? channels : max_channels;
+	lane_count = (channel_count + lanes_per_vector - 1) / lanes_per_vector *
+				 lanes_per_vector;
+}
+
+void FilterBank::set_ema(float alpha)
+{
+	/*
+	   Exponential moving average, alpha is the
+	   weight of a new sample between 0 and 1.
+	*/
+
+	kernel = Kernel::ema;
+	this->alpha = alpha;
+	reset();
+}
+
+void FilterBank::set_dema(float alpha, float beta)
+{
+	/*
+	   Double exponential moving average like
+	   okapi's DemaFilter, beta is the weight of a
+	   new trend.  Follows ramps without the lag of
+	   an ema.
+	*/
+
+	kernel = Kernel::dema;
+	this->alpha = alpha;
+	this->beta = beta;
+	reset();
+}
+
+void FilterBank::set_median()
+{
+	/*
+	   Median of the last median_size samples,
+	   which drops single spikes entirely.
+	*/
+
+	kernel = Kernel::median;
+	reset();
+}
+
+void FilterBank::set_biquad(float b0, float b1, float b2, float a1, float a2)
+{
+	/*
+	   Second order IIR filter with the transfer
+	   function (b0 + b1 z^-1 + b2 z^-2) /
+	   (1 + a1 z^-1 + a2 z^-2).
+	*/
+
+	kernel = Kernel::biquad;
+	this->b0 = b0;
+	this->b1 = b1;
+	this->b2 = b2;
+	this->a1 = a1;
+	this->a2 = a2;
+	reset();
+}
+
+void FilterBank::set_lowpass(float cutoff, float sample_rate)
+{
+	/*
+	   Butterworth low-pass biquad, cutoff and
+	   sample_rate in Hz, for example 5 and 100 to
+	   smooth a signal sampled every 10ms.
+	*/
+
+	float omega = 2 * M_PI * cutoff / sample_rate;
+	float alpha = sin(omega) / (2 * M_SQRT1_2);
+	float cos_omega = cos(omega);
+	float a0 = 1 + alpha;
+
+	set_biquad((1 - cos_omega) / 2 / a0, (1 - cos_omega) / a0,
+			   (1 - cos_omega) / 2 / a0, -2 * cos_omega / a0, (1 - alpha) / a0);
+}
+
+void FilterBank::reset()
+{
+	/*
+	   Forgets every channel's history.  The next
+	   update() starts each filter from its input,
+	   as if it had been steady all along.
+	*/
+
+	seeded = false;
+}
+
+void FilterBank::set_input(std::size_t channel, float value)
+{
+	/*
+	   Sets the sample of a channel for the next
+	   update().
+	*/
+
+	if(channel < channel_count)
+	{
+		input[channel] = value;
+	}
+}
+
+void FilterBank::set_inputs(const float* values)
+{
+	/*
+	   Sets the samples of every channel at once from
+	   an array of size() values.
+	*/
+
+	std::copy(values, values + channel_count, input);
+}
+
+void FilterBank::update()
+{
+	/*
+	   Filters every channel once.
+	*/
+
+	if(!seeded)
+	{
+		seed();
+		seeded = true;
+		return;
+	}
+
+	switch(kernel)
+	{
+		case Kernel::ema:
+			update_ema();
+			break;
+		case Kernel::dema:
+			update_dema();
+			break;
+		case Kernel::median:
+			update_median();
+			break;
+		case Kernel::biquad:
+			update_biquad();
+			break;
+	}
+}
+
+float FilterBank::get_output(std::size_t channel)
+{
+	/*
+	   Returns the filtered value of a channel.
+	*/
+
+	return channel < channel_count ? output[channel] : 0;
+}
+
+const float* FilterBank::get_outputs()
+{
+	/*
+	   Returns the filtered values of every channel,
+	   valid until the next update().
+	*/
+
+	return output;
+}
+
+std::size_t FilterBank::size()
+{
+	/*
+	   Returns the number of channels.
+	*/
+
+	return channel_count;
+}
+
+void FilterBank::seed()
+{
+	/*
+	   Sets every filter's state to what it would be
+	   had the first input been steady forever.
+	*/
+
+	float gain = (b0 + b1 + b2) / (1 + a1 + a2);
+	for(std::size_t i = 0; i < lane_count; i++)
+	{
+		float value = input[i];
+		output[i] = value;
+		state_one[i] = 0;
+		state_two[i] = 0;
+		for(std::size_t j = 0; j < median_size; j++)
+		{
+			history[j][i] = value;
+		}
+
+		if(kernel == Kernel::biquad)
+		{
+			output[i] = gain * value;
+			state_two[i] = b2 * value - a2 * output[i];
+			state_one[i] = b1 * value - a1 * output[i] + state_two[i];
+		}
+	}
+	history_next = 0;
+}
+
+void FilterBank::update_ema()
+{
+	/*
+	   y += alpha * (x - y)
+	*/
+
+	Vector weight = splat(alpha);
+	for(std::size_t i = 0; i < lane_count; i += lanes_per_vector)
+	{
+		Vector last = load(output + i);
+		store(output + i, last + weight * (load(input + i) - last));
+	}
+}
+
+void FilterBank::update_dema()
+{
+	/*
+	   s = alpha * x + (1 - alpha) * (s + trend)
+	   trend = beta * (s - last s) + (1 - beta) * trend
+	*/
+
+	Vector weight = splat(alpha);
+	Vector keep = splat(1 - alpha);
+	Vector trend_weight = splat(beta);
+	Vector trend_keep = splat(1 - beta);
+	for(std::size_t i = 0; i < lane_count; i += lanes_per_vector)
+	{
+		Vector last = load(output + i);
+		Vector trend = load(state_one + i);
+		Vector value = weight * load(input + i) + keep * (last + trend);
+		store(output + i, value);
+		store(state_one + i,
+			  trend_weight * (value - last) + trend_keep * trend);
+	}
+}
+
+void FilterBank::update_median()
+{
+	/*
+	   Replaces the oldest sample and sorts the five
+	   samples of four channels at once with a
+	   sorting network, the middle one is the median.
+	*/
+
+	for(std::size_t i = 0; i < lane_count; i++)
+	{
+		history[history_next][i] = input[i];
+	}
+	history_next = (history_next + 1) % median_size;
+
+	for(std::size_t i = 0; i < lane_count; i += lanes_per_vector)
+	{
+		Vector v0 = load(history[0] + i);
+		Vector v1 = load(history[1] + i);
+		Vector v2 = load(history[2] + i);
+		Vector v3 = load(history[3] + i);
+		Vector v4 = load(history[4] + i);
+
+		// sorts five values, leaving the median in v2
+		sort_pair(v0, v1);
+		sort_pair(v3, v4);
+		sort_pair(v2, v4);
+		sort_pair(v2, v3);
+		sort_pair(v0, v3);
+		sort_pair(v0, v2);
+		sort_pair(v1, v4);
+		sort_pair(v1, v3);
+		sort_pair(v1, v2);
+
+		store(output + i, v2);
+	}
+}
+
+void FilterBank::update_biquad()
+{
+	/*
+	   Direct form II transposed:
+	   y = b0 * x + z1
+	   z1 = b1 * x - a1 * y + z2
+	   z2 = b2 * x - a2 * y
+	*/
+
+	Vector c_b0 = splat(b0);
+	Vector c_b1 = splat(b1);
+	Vector c_b2 = splat(b2);
+	Vector c_a1 = splat(a1);
+	Vector c_a2 = splat(a2);
+	for(std::size_t i = 0; i < lane_count; i += lanes_per_vector)
+	{
+		Vector x = load(input + i);
+		Vector z2 = load(state_two + i);
+		Vector y = c_b0 * x + load(state_one + i);
+		store(output + i, y);
+		store(state_one + i, c_b1 * x - c_a1 * y + z2);
+		store(state_two + i, c_b2 * x - c_a2 * y);
+	}
+}
@@ -0,0 +1,86 @@
+#ifndef FILTER_BANK_HPP
+#define FILTER_BANK_HPP
+
+/*
+	The FilterBank class filters many signals at
+	once, for example the velocity or current of
+	every motor on the robot.
+
+	Every channel's state lives side by side in
+	plain arrays instead of one filter object per
+	signal, so a tick is a single pass that filters
+	four channels per instruction with NEON on the
+	brain and SSE on a desktop.  All channels of a
+	bank share one filter: an exponential moving
+	average, a double exponential moving average, a
+	median of the last median_size samples or a
+	biquad (second order IIR, for example a
+	low-pass).
+*/
+
+class FilterBank
+{
+	public:
+	FilterBank(std::size_t channels);
+
+	// filter, shared by every channel
+	void set_ema(float alpha);
+	void set_dema(float alpha, float beta);
+	void set_median();
+	void set_biquad(float b0, float b1, float b2, float a1, float a2);
+	void set_lowpass(float cutoff, float sample_rate);
+	void reset();
+
+	// samples
+	void set_input(std::size_t channel, float value);
+	void set_inputs(const float* values);
+	void update();
+	float get_output(std::size_t channel);
+	const float* get_outputs();
+	std::size_t size();
+
+	static constexpr std::size_t max_channels = 32;
+	static constexpr std::size_t median_size = 5;
+
+	private:
+	enum class Kernel
+	{
+		ema,
+		dema,
+		median,
+		biquad
+	};
+
+	void seed();
+	void update_ema();
+	void update_dema();
+	void update_median();
+	void update_biquad();
+
+	std::size_t channel_count;
+	// channels rounded up to whole vectors
+	std::size_t lane_count;
+	Kernel kernel = Kernel::ema;
+	bool seeded = false;
+
+	// coefficients
+	float alpha = 1;
+	float beta = 0;
+	float b0 = 1;
+	float b1 = 0;
+	float b2 = 0;
+	float a1 = 0;
+	float a2 = 0;
+
+	alignas(16) float input[max_channels] = {};
+	alignas(16) float output[max_channels] = {};
+	// dema trend or the first biquad delay
+	alignas(16) float state_one[max_channels] = {};
+	// second biquad delay
+	alignas(16) float state_two[max_channels] = {};
+	// median history, one row per sample
+	alignas(16) float history[median_size][max_channels] = {};
+	std::size_t history_next = 0;
+};
+
+#endif
@@ -0,0 +1,541 @@
+#include "main.h"
+#include "pros-sim.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+   Runs the autonomous routine of competition.cpp
+   thousands of times on the host, each run on a
+   robot whose motors, battery, friction and sensor
+   noise are drawn from the run's seed, and reports
+   how long the routine took and how far from the
+   nominal robot's run it ended.
+
+   Each run is a process forked from the freshly
+   loaded program, as many at once as there are
+   cores, so no run sees what another left behind.
+   The sim schedules the robot's tasks the same way
+   every time, so --seed replays any run exactly,
+   with a trace of where the robot went.
+
+   The nominal run's drive moves are timed from its
+   motion log against how long each would take at
+   the drive's free speed, with whatever follows the
+   last move (the deploy) as the rest.  --field
+   adds the times from a motion log autonomous saved
+   on the robot (/usd/motion.log), to check the sim
+   against a real run.  If the nominal robot doesn't
+   finish within the period, every run is measured
+   past where the field would have stopped it, so
+   this says so and exits with 2.
+
+   usage: auton-sweep [runs] [-j jobs] [--field log]
+		  auton-sweep --seed n [--field log]
+*/
+
+namespace
+{
+// the autonomous period, runs still going at the limit are stopped
+const std::uint32_t PERIOD = 15000;
+const std::uint32_t TIME_LIMIT = 60000;
+const std::uint32_t TRACE_INTERVAL = 250;
+const std::size_t OUTLIERS = 5;
+
+// the drive and motors as config/main.cpp sets them up
+const std::uint8_t LEFT_DRIVE = 1;
+const std::uint8_t RIGHT_DRIVE = 2;
+const std::uint8_t IMU_PORT = 10;
+const double WHEEL_DIAMETER = 4;
+const double TRACK_WIDTH = 12.5;
+const double DRIVE_RPM = 200;
+const std::uint8_t MOTOR_PORTS[] = { 1, 2, 3, 4, 5, 6, 12, 13 };
+// ms each tick of move_pid and turn_pid waits
+const std::uint32_t PID_INTERVAL = 10;
+// mV a motor loses to friction on the nominal robot
+const int FRICTION = 400;
+
+struct Result
+{
+	std::uint32_t seed;
+	bool done; // false if the run crashed
+	bool finished; // false if it was stopped at the time limit
+	std::uint32_t time; // ms from the start of autonomous
+	// where the robot really ended, and how far off the estimate was
+	double x;
+	double y;
+	double heading;
+	double estimate_error;
+};
+
+// a drive move of a motion log and how long it ran
+struct MoveTime
+{
+	MoveKind kind;
+	int position_delta;
+	int max_speed;
+	std::uint32_t time;
+};
+
+Result* result = nullptr;
+std::uint32_t start_time = 0;
+// the nominal run while a run is replayed with a trace
+const Result* tracing = nullptr;
+// where the nominal run saves its motion log
+const char* nominal_log = nullptr;
+
+double uniform(std::mt19937& source, double low, double high)
+{
+	/*
+	   a draw between low and high
+	*/
+	return std::uniform_real_distribution<double>(low, high)(source);
+}
+
+void randomize(std::uint32_t seed)
+{
+	/*
+	   draws the robot for a seed, seed 0 is the
+	   nominal robot with no noise
+	*/
+	for(std::uint8_t port : MOTOR_PORTS)
+	{
+		sim::motor(port).friction = FRICTION;
+	}
+	if(seed == 0)
+	{
+		return;
+	}
+
+	std::mt19937 source(seed);
+	for(std::uint8_t port : MOTOR_PORTS)
+	{
+		sim::MotorState& motor = sim::motor(port);
+		motor.speed_scale = uniform(source, 0.92, 1.03);
+		motor.time_constant = uniform(source, 0.06, 0.11);
+		motor.friction = uniform(source, FRICTION / 2, FRICTION * 2);
+	}
+	// some batteries sag below the compensator's 11V
+	double battery = uniform(source, 10800, 12900);
+	sim::set_battery(battery);
+	double encoder = uniform(source, 0, 1);
+	double gyro = uniform(source, 0, 0.3);
+	double bias = uniform(source, -0.05, 0.05);
+	sim::set_noise(encoder, gyro, bias, source());
+
+	if(tracing)
+	{
+		std::printf("port  speed  lag (ms)  friction (mV)\n");
+		for(std::uint8_t port : MOTOR_PORTS)
+		{
+			sim::MotorState& motor = sim::motor(port);
+			std::printf("%4u %6.3f %9.1f %14d\n", port, motor.speed_scale,
+						motor.time_constant * 1000, motor.friction);
+		}
+		std::printf("battery %.0fmV, encoder noise %.2f deg, gyro noise "
+					"%.2f deg/s, gyro bias %.3f deg/s\n\n",
+					battery, encoder, gyro, bias);
+	}
+}
+
+void finish(bool finished)
+{
+	/*
+	   records where the run ended
+	*/
+	sim::DriveState& drive = sim::drive();
+	result->finished = finished;
+	result->time = pros::millis() - start_time;
+	result->x = drive.x;
+	result->y = drive.y;
+	result->heading = drive.heading;
+	result->estimate_error =
+		std::hypot(pose.get_x() - drive.x, pose.get_y() - drive.y);
+	if(result->seed == 0 && nominal_log != nullptr)
+	{
+		drive_log.stop_recording(nominal_log);
+	}
+	result->done = true;
+}
+
+void print_result(const Result& run, const Result& nominal)
+{
+	/*
+	   one run against the nominal one
+	*/
+	std::printf("%s after %ums at (%.1f, %.1f) %.1f deg, %.2fin and %.2f deg "
+				"from nominal, estimate off by %.2fin\n",
+				run.finished ? "finished" : "stopped", run.time, run.x, run.y,
+				run.heading * 180 / M_PI,
+				std::hypot(run.x - nominal.x, run.y - nominal.y),
+				std::abs(run.heading - nominal.heading) * 180 / M_PI,
+				run.estimate_error);
+}
+
+void expired()
+{
+	/*
+	   stops a run that is still going at the limit
+	*/
+	finish(false);
+	if(tracing)
+	{
+		print_result(*result, *tracing);
+		std::fflush(stdout);
+	}
+	std::_Exit(0);
+}
+
+void trace(void* param)
+{
+	/*
+	   where the robot is against where it thinks it
+	   is, while a run is replayed
+	*/
+	std::printf("%7s %8s %8s %8s   %8s %8s %8s\n", "ms", "x", "y", "deg",
+				"est x", "est y", "est deg");
+	std::uint32_t now = pros::millis();
+	while(true)
+	{
+		sim::DriveState& drive = sim::drive();
+		std::printf("%7u %8.2f %8.2f %8.2f   %8.2f %8.2f %8.2f\n",
+					now - start_time, drive.x, drive.y,
+					drive.heading * 180 / M_PI, pose.get_x(), pose.get_y(),
+					pose.get_heading() * 180 / M_PI);
+		pros::Task::delay_until(&now, TRACE_INTERVAL);
+	}
+}
+
+void run(std::uint32_t seed, Result& slot)
+{
+	/*
+	   one run of autonomous, from initialize() on
+	*/
+	result = &slot;
+	result->seed = seed;
+	randomize(seed);
+	sim::set_drive(LEFT_DRIVE, RIGHT_DRIVE, IMU_PORT, WHEEL_DIAMETER,
+				   TRACK_WIDTH);
+	sim::set_scheduling(true);
+	sim::set_time_limit(TIME_LIMIT, expired);
+
+	initialize();
+	start_time = pros::millis();
+	if(tracing)
+	{
+		new pros::Task(trace, nullptr, TASK_PRIORITY_MAX,
+					   TASK_STACK_DEPTH_DEFAULT, "trace");
+	}
+	autonomous();
+	finish(true);
+}
+
+bool sweep(Result* results, std::uint32_t first, std::uint32_t count,
+		   long jobs)
+{
+	/*
+	   runs the seeds from first in forked processes,
+	   jobs at a time
+	*/
+	long running = 0;
+	for(std::uint32_t i = 0; i < count; i++)
+	{
+		if(running == jobs)
+		{
+			wait(nullptr);
+			running--;
+		}
+		pid_t pid = fork();
+		if(pid < 0)
+		{
+			std::perror("fork");
+			return false;
+		}
+		if(pid == 0)
+		{
+			run(first + i, results[i]);
+			std::_Exit(0);
+		}
+		running++;
+	}
+	while(running-- > 0)
+	{
+		wait(nullptr);
+	}
+	return true;
+}
+
+double percentile(std::vector<double> values, double fraction)
+{
+	/*
+	   the value fraction of the way through the
+	   sorted values
+	*/
+	if(values.empty())
+	{
+		return NAN;
+	}
+	std::sort(values.begin(), values.end());
+	return values[std::lround(fraction * (values.size() - 1))];
+}
+
+bool load_moves(const char* path, std::vector<MoveTime>& moves)
+{
+	/*
+	   the drive moves of a motion log, false if it
+	   can't be read
+	*/
+	if(!drive_log.load(path))
+	{
+		return false;
+	}
+	MotionMove move;
+	while(drive_log.next_move(move))
+	{
+		moves.push_back({ move.kind, move.position_delta, move.max_speed,
+						  std::uint32_t(move.ticks * PID_INTERVAL) });
+	}
+	return true;
+}
+
+std::uint32_t free_speed_time(const MoveTime& move)
+{
+	/*
+	   ms the move takes with the drive at its free
+	   speed from the first tick to the last
+	*/
+	double speed = std::min(std::abs(move.max_speed), 127) / 127.0;
+	double degrees_per_ms = DRIVE_RPM * 360 / 60000 * speed;
+	return std::lround(std::abs(move.position_delta) / degrees_per_ms);
+}
+
+std::uint32_t print_budget(const Result& nominal,
+						   const std::vector<MoveTime>& moves,
+						   const std::vector<MoveTime>& field)
+{
+	/*
+	   where the nominal run's time went, move by
+	   move, returns how long the moves take at free
+	   speed
+	*/
+	std::printf("%4s %4s %6s %6s %11s %8s %8s\n", "move", "kind", "delta",
+				"speed", "free (ms)", "sim (ms)", "field");
+	std::uint32_t free_total = 0, sim_total = 0, field_total = 0;
+	for(std::size_t i = 0; i < moves.size(); i++)
+	{
+		const MoveTime& move = moves[i];
+		std::uint32_t free_time = free_speed_time(move);
+		free_total += free_time;
+		sim_total += move.time;
+		std::printf("%4zu %4s %6d %6d %11u %8u ", i,
+					move.kind == MoveKind::turn ? "turn" : "move",
+					move.position_delta, move.max_speed, free_time, move.time);
+		// a field log of a different routine can't be lined up
+		if(i < field.size() && field[i].kind == move.kind &&
+		   field[i].position_delta == move.position_delta)
+		{
+			field_total += field[i].time;
+			std::printf("%8u\n", field[i].time);
+		}
+		else
+		{
+			std::printf("%8s\n", "-");
+		}
+	}
+	std::printf("%-23s %11u %8u", "moves", free_total, sim_total);
+	if(!field.empty())
+	{
+		std::printf(" %8u", field_total);
+	}
+	std::printf("\n%-23s %11s %8u\n\n", "the rest (deploy)", "",
+				nominal.time - std::min(nominal.time, sim_total));
+	return free_total;
+}
+
+bool report_late(const Result& nominal, std::uint32_t free_total)
+{
+	/*
+	   says so if the nominal robot is still going
+	   when the field would stop it
+	*/
+	if(nominal.time <= PERIOD)
+	{
+		return false;
+	}
+	std::printf("the nominal robot finishes %ums after the %us period ends, "
+				"its moves alone take %ums at free speed\n\n",
+				nominal.time - PERIOD, PERIOD / 1000, free_total);
+	return true;
+}
+
+void print_distribution(const char* name, const std::vector<double>& values)
+{
+	/*
+	   one row of the report
+	*/
+	std::printf("%-20s %8.2f %8.2f %8.2f %8.2f %8.2f\n", name,
+				percentile(values, 0), percentile(values, 0.05),
+				percentile(values, 0.5), percentile(values, 0.95),
+				percentile(values, 1));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::uint32_t runs = 2000;
+	long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	long replay = -1;
+	const char* field_log = nullptr;
+	for(int i = 1; i < argc; i++)
+	{
+		if(std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+		{
+			jobs = std::max(1L, std::atol(argv[++i]));
+		}
+		else if(std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+		{
+			replay = std::atol(argv[++i]);
+		}
+		else if(std::strcmp(argv[i], "--field") == 0 && i + 1 < argc)
+		{
+			field_log = argv[++i];
+		}
+		else if(argv[i][0] != '-')
+		{
+			runs = std::atol(argv[i]);
+		}
+		else
+		{
+			std::fprintf(stderr,
+						 "usage: %s [runs] [-j jobs] [--field log]\n"
+						 "       %s --seed n [--field log]\n",
+						 argv[0], argv[0]);
+			return 1;
+		}
+	}
+
+	// the nominal run first, then the sweep or the replay
+	std::size_t slots = replay >= 0 ? 2 : runs + 1;
+	Result* results = static_cast<Result*>(
+		mmap(nullptr, slots * sizeof(Result), PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+	if(results == MAP_FAILED)
+	{
+		std::perror("mmap");
+		return 1;
+	}
+	char log_path[] = "/tmp/auton-sweep-XXXXXX";
+	int log_file = mkstemp(log_path);
+	if(log_file < 0)
+	{
+		std::perror("mkstemp");
+		return 1;
+	}
+	close(log_file);
+	nominal_log = log_path;
+	bool nominal_done = sweep(results, 0, 1, 1) && results[0].done;
+	std::vector<MoveTime> moves, field;
+	bool moves_loaded = nominal_done && load_moves(log_path, moves);
+	unlink(log_path);
+	nominal_log = nullptr;
+	if(!nominal_done)
+	{
+		std::fprintf(stderr, "the nominal run crashed\n");
+		return 1;
+	}
+	if(!moves_loaded)
+	{
+		std::fprintf(stderr, "the nominal run saved no motion log\n");
+		return 1;
+	}
+	if(field_log != nullptr && !load_moves(field_log, field))
+	{
+		std::fprintf(stderr, "%s is not a motion log\n", field_log);
+		return 1;
+	}
+	const Result& nominal = results[0];
+
+	if(replay >= 0)
+	{
+		std::printf("nominal: ");
+		print_result(nominal, nominal);
+		std::printf("\n");
+		std::uint32_t free_total = print_budget(nominal, moves, field);
+		bool late = report_late(nominal, free_total);
+		std::printf("seed %ld\n", replay);
+		tracing = &nominal;
+		std::fflush(stdout);
+		run(replay, results[1]);
+		print_result(results[1], nominal);
+		return late ? 2 : 0;
+	}
+
+	if(!sweep(results + 1, 1, runs, jobs))
+	{
+		return 1;
+	}
+
+	std::vector<double> times, position_errors, heading_errors,
+		estimate_errors;
+	std::vector<const Result*> outliers;
+	std::uint32_t crashed = 0, stopped = 0, late = 0;
+	for(std::uint32_t i = 1; i <= runs; i++)
+	{
+		const Result& run = results[i];
+		if(!run.done)
+		{
+			crashed++;
+			continue;
+		}
+		stopped += !run.finished;
+		late += run.time > PERIOD;
+		times.push_back(run.time);
+		position_errors.push_back(
+			std::hypot(run.x - nominal.x, run.y - nominal.y));
+		heading_errors.push_back(std::abs(run.heading - nominal.heading) *
+								 180 / M_PI);
+		estimate_errors.push_back(run.estimate_error);
+		outliers.push_back(&run);
+	}
+
+	std::printf("%u runs on %ld cores, nominal ", runs, jobs);
+	print_result(nominal, nominal);
+	std::printf("%u over the %us period, %u stopped at %us, %u crashed\n\n",
+				late, PERIOD / 1000, stopped, TIME_LIMIT / 1000, crashed);
+	std::uint32_t free_total = print_budget(nominal, moves, field);
+	bool nominal_late = report_late(nominal, free_total);
+	std::printf("%-20s %8s %8s %8s %8s %8s\n", "", "min", "p5", "median",
+				"p95", "max");
+	print_distribution("time (ms)", times);
+	print_distribution("position error (in)", position_errors);
+	print_distribution("heading error (deg)", heading_errors);
+	print_distribution("estimate error (in)", estimate_errors);
+
+	// the runs that ended furthest off, stopped runs first
+	auto error = [&](const Result* run) {
+		return std::hypot(run->x - nominal.x, run->y - nominal.y);
+	};
+	std::sort(outliers.begin(), outliers.end(),
+			  [&](const Result* a, const Result* b) {
+				  if(a->finished != b->finished)
+				  {
+					  return !a->finished;
+				  }
+				  return error(a) > error(b);
+			  });
+	std::printf("\nreplay with --seed n\n");
+	for(std::size_t i = 0; i < std::min(OUTLIERS, outliers.size()); i++)
+	{
+		std::printf("%6u  ", outliers[i]->seed);
+		print_result(*outliers[i], nominal);
+	}
+	return nominal_late ? 2 : 0;
+}
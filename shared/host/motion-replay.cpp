@@ -0,0 +1,224 @@
+#include "main.h"
+#include "pros-sim.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/*
+   Replays the drive's PID moves from a motion log
+   saved by autonomous (/usd/motion.log) through the
+   same move_pid and turn_pid the robot ran, and
+   reports for every move whether the outputs came
+   out the same as on the field.
+
+   The controllers are fed the recorded sensor
+   readings and clock, so with the recorded gains
+   every output matches bit for bit.  New gains
+   show where and by how much the outputs would
+   have changed on that run, tick by tick, in a
+   fraction of the time the run took.  A replay
+   can't show how the robot would have moved on
+   those outputs, once they differ the readings
+   that follow are still the field's.
+
+   --record runs autonomous on the nominal sim
+   robot and writes its log, to try the replay
+   without a robot.
+
+   usage: motion-replay log [--gains kP kI kD] [--turn-gains kP kI kD]
+		  motion-replay --record log
+*/
+
+namespace
+{
+// the drive as config/main.cpp sets it up, see auton-sweep.cpp
+const std::uint8_t LEFT_DRIVE = 1;
+const std::uint8_t RIGHT_DRIVE = 2;
+const std::uint8_t IMU_PORT = 10;
+const double WHEEL_DIAMETER = 4;
+const double TRACK_WIDTH = 12.5;
+const std::uint8_t MOTOR_PORTS[] = { 1, 2, 3, 4, 5, 6, 12, 13 };
+const int FRICTION = 400;
+
+struct Gains
+{
+	bool set;
+	double kP, kI, kD;
+};
+
+const char* end_name(ReplayEnd end)
+{
+	/*
+	   how a move ended, for the report
+	*/
+	switch(end)
+	{
+	case ReplayEnd::same:
+		return "settled with the recording";
+	case ReplayEnd::settled_early:
+		return "settled early";
+	case ReplayEnd::settled_late:
+		return "still going where the recording settled";
+	case ReplayEnd::missing_value:
+		return "read a value the recording didn't";
+	}
+	return "";
+}
+
+int record(const char* path)
+{
+	/*
+	   autonomous on the nominal robot, logged
+	*/
+	for(std::uint8_t port : MOTOR_PORTS)
+	{
+		sim::motor(port).friction = FRICTION;
+	}
+	sim::set_drive(LEFT_DRIVE, RIGHT_DRIVE, IMU_PORT, WHEEL_DIAMETER,
+				   TRACK_WIDTH);
+	sim::set_scheduling(true);
+
+	initialize();
+	autonomous();
+	std::size_t moves = drive_log.get_move_count();
+	if(!drive_log.stop_recording(path))
+	{
+		std::fprintf(stderr, "could not write %s\n", path);
+		return 1;
+	}
+	std::printf("recorded %zu moves to %s\n", moves, path);
+	return 0;
+}
+
+int replay(const char* path, const Gains& gains, const Gains& turn_gains)
+{
+	/*
+	   every move of the log, compared with the
+	   recording
+	*/
+	initialize();
+	if(!drive_log.load(path))
+	{
+		std::fprintf(stderr, "%s is not a motion log\n", path);
+		return 1;
+	}
+
+	std::printf("%4s %4s %6s %6s %5s   %6s %8s %8s %9s\n", "move", "kind",
+				"delta", "speed", "ticks", "ticks", "diverged", "first at",
+				"most (mV)");
+	std::size_t moves = 0, differing = 0, ticks = 0;
+	auto start = std::chrono::steady_clock::now();
+	MotionMove move;
+	while(drive_log.next_move(move))
+	{
+		bool turn = move.kind == MoveKind::turn;
+		const Gains& given = turn ? turn_gains : gains;
+		double kP = given.set ? given.kP : move.kP;
+		double kI = given.set ? given.kI : move.kI;
+		double kD = given.set ? given.kD : move.kD;
+		if(turn)
+		{
+			drive.set_pid_turn_constants(kP, kI, kD);
+			drive.turn_pid(move.position_delta, move.max_speed,
+						   move.error_threshold);
+		}
+		else
+		{
+			drive.set_pid_constants(kP, kI, kD);
+			drive.move_pid(move.position_delta, move.max_speed,
+						   move.error_threshold);
+		}
+
+		MoveReplay result = drive_log.get_replay();
+		std::printf("%4zu %4s %6d %6d %5zu   %6zu %8zu ", moves,
+					turn ? "turn" : "move",
+					move.position_delta, move.max_speed, move.ticks,
+					result.ticks, result.diverged);
+		if(result.diverged > 0)
+		{
+			std::printf("%8zu %9d", result.first_divergence,
+						result.max_difference);
+		}
+		else
+		{
+			std::printf("%8s %9s", "-", "-");
+		}
+		std::printf("   %s\n", end_name(result.end));
+
+		moves++;
+		ticks += result.ticks;
+		differing += result.diverged > 0 || result.end != ReplayEnd::same;
+	}
+	double elapsed = std::chrono::duration<double, std::milli>(
+						 std::chrono::steady_clock::now() - start)
+						 .count();
+
+	std::printf("\n%zu of %zu moves differ from the recording, %zu ticks "
+				"replayed in %.2fms\n",
+				differing, moves, ticks, elapsed);
+	return differing > 0 ? 2 : 0;
+}
+
+bool parse_gains(int argc, char** argv, int& i, Gains& gains)
+{
+	/*
+	   the three gains after an option
+	*/
+	if(i + 3 >= argc)
+	{
+		return false;
+	}
+	gains.set = true;
+	gains.kP = std::atof(argv[++i]);
+	gains.kI = std::atof(argv[++i]);
+	gains.kD = std::atof(argv[++i]);
+	return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	const char* path = nullptr;
+	bool recording = false;
+	Gains gains = {}, turn_gains = {};
+	bool parsed = true;
+	for(int i = 1; i < argc && parsed; i++)
+	{
+		if(std::strcmp(argv[i], "--gains") == 0)
+		{
+			parsed = parse_gains(argc, argv, i, gains);
+		}
+		else if(std::strcmp(argv[i], "--turn-gains") == 0)
+		{
+			parsed = parse_gains(argc, argv, i, turn_gains);
+		}
+		else if(std::strcmp(argv[i], "--record") == 0)
+		{
+			recording = true;
+		}
+		else if(argv[i][0] != '-' && path == nullptr)
+		{
+			path = argv[i];
+		}
+		else
+		{
+			parsed = false;
+		}
+	}
+	if(!parsed || path == nullptr)
+	{
+		std::fprintf(stderr,
+					 "usage: %s log [--gains kP kI kD] [--turn-gains kP kI "
+					 "kD]\n       %s --record log\n",
+					 argv[0], argv[0]);
+		return 1;
+	}
+
+	if(recording)
+	{
+		return record(path);
+	}
+	return replay(path, gains, turn_gains);
+}
@@ -0,0 +1,1034 @@
+#include "main.h"
+#include "pros-sim.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+#include <ucontext.h>
+
+namespace
+{
+const double STALL_CURRENT = 2500; // mA at full voltage and zero speed
+const double INCHES_PER_G = 386.09;
+const std::size_t TASK_STACK_SIZE = 256 * 1024;
+
+// a task, or the caller of the sim once scheduling is on
+struct Thread
+{
+	ucontext_t context;
+	std::unique_ptr<char[]> stack;
+	pros::task_fn_t function = nullptr;
+	void* parameters = nullptr;
+	std::uint32_t priority = TASK_PRIORITY_DEFAULT;
+	std::uint32_t wake = 0; // ms it waits until
+	bool waiting = false; // for a notification, until wake at the latest
+	std::uint32_t notifications = 0;
+	bool removed = false;
+};
+
+sim::MotorState motors[22];
+sim::ImuState imus[22];
+std::uint32_t now = 0;
+double stepping_ns = 0;
+// wall clock at reset, and ns spent running robot code by the last step
+std::chrono::steady_clock::time_point started =
+	std::chrono::steady_clock::now();
+double code_ns_at_step = 0;
+double battery_voltage = 12800;
+bool competition_disabled = false;
+int analog_inputs[4];
+bool digital_inputs[18];
+pros::vision_object_s_t vision_objects[16];
+std::size_t vision_count = 0;
+
+// tasks are never freed, robot objects may still remove them
+Thread main_thread;
+std::vector<Thread*> threads;
+// the thread on the cpu, null while scheduling is off
+Thread* running = nullptr;
+std::uint32_t time_limit = TIMEOUT_MAX;
+void (*limit_expired)() = nullptr;
+
+bool drive_declared = false;
+std::uint8_t drive_ports[3]; // left, right and inertial sensor
+double wheel_circumference = 0;
+double drive_track_width = 0;
+sim::DriveState drive_state;
+
+std::mt19937 noise_source;
+double encoder_noise = 0;
+double gyro_noise = 0;
+double gyro_bias = 0;
+
+int cartridge_speed(pros::motor_gearset_e_t gearset)
+{
+	/*
+	   output shaft free speed of each cartridge
+	*/
+	switch(gearset)
+	{
+		case pros::E_MOTOR_GEARSET_36:
+			return 100;
+		case pros::E_MOTOR_GEARSET_06:
+			return 600;
+		default:
+			return 200;
+	}
+}
+
+double direction(const sim::MotorState& state)
+{
+	/*
+	   reversed motors report and take commands mirrored
+	*/
+	return state.reversed ? -1 : 1;
+}
+
+double gaussian(double deviation)
+{
+	/*
+	   a noise sample, drawn only when there is noise so
+	   quiet runs don't use up the sequence
+	*/
+	if(deviation == 0)
+	{
+		return 0;
+	}
+	return std::normal_distribution<double>(0, deviation)(noise_source);
+}
+
+void move_drive(double dt)
+{
+	/*
+	   moves the robot by the speed of each side of
+	   the drive and turns the inertial sensor with it
+	*/
+	const sim::MotorState& left = motors[drive_ports[0]];
+	const sim::MotorState& right = motors[drive_ports[1]];
+	double left_speed =
+		left.velocity * direction(left) / 60 * wheel_circumference;
+	double right_speed =
+		right.velocity * direction(right) / 60 * wheel_circumference;
+	double velocity = (left_speed + right_speed) / 2;
+	double turn_rate = (right_speed - left_speed) / drive_track_width;
+
+	drive_state.x += velocity * std::cos(drive_state.heading) * dt;
+	drive_state.y += velocity * std::sin(drive_state.heading) * dt;
+	drive_state.heading += turn_rate * dt;
+
+	// the sensor turns clockwise positive and drifts by its bias
+	sim::ImuState& imu = imus[drive_ports[2]];
+	double rate = -turn_rate * 180 / M_PI + gyro_bias;
+	imu.rotation += rate * dt;
+	imu.gyro_rate = rate + gaussian(gyro_noise);
+	imu.acceleration =
+		(velocity - drive_state.velocity) / dt / INCHES_PER_G;
+	drive_state.velocity = velocity;
+}
+
+bool ready(const Thread& thread)
+{
+	/*
+	   whether a thread can run at the current time
+	*/
+	return !thread.removed &&
+		   (thread.wake <= now || thread.waiting && thread.notifications > 0);
+}
+
+Thread* pick()
+{
+	/*
+	   the highest priority ready thread, the one made
+	   first of those at the same priority
+	*/
+	Thread* next = ready(main_thread) ? &main_thread : nullptr;
+	for(Thread* thread : threads)
+	{
+		if(ready(*thread) &&
+		   (next == nullptr || thread->priority > next->priority))
+		{
+			next = thread;
+		}
+	}
+	return next;
+}
+
+void schedule()
+{
+	/*
+	   runs the next thread, moving the clock until one
+	   is ready.  Returns once the caller runs again.
+	*/
+	Thread* next;
+	while((next = pick()) == nullptr)
+	{
+		bool wakes = main_thread.wake != TIMEOUT_MAX;
+		for(Thread* thread : threads)
+		{
+			wakes = wakes || !thread->removed && thread->wake != TIMEOUT_MAX;
+		}
+		if(!wakes)
+		{
+			std::fprintf(stderr, "sim: every task waits forever at %ums\n",
+						 now);
+			std::abort();
+		}
+		sim::step(1);
+	}
+
+	Thread* previous = running;
+	running = next;
+	if(next != previous)
+	{
+		swapcontext(&previous->context, &next->context);
+	}
+}
+
+void wait_until(std::uint32_t time)
+{
+	/*
+	   blocks the running thread until time, or steps
+	   the clock there while scheduling is off
+	*/
+	if(running == nullptr)
+	{
+		if(time > now)
+		{
+			sim::step(time - now);
+		}
+		return;
+	}
+	running->wake = time;
+	schedule();
+}
+
+double code_ns()
+{
+	/*
+	   wall clock ns spent running robot code since
+	   reset, the time stepping the sim left out
+	*/
+	std::chrono::duration<double, std::nano> elapsed =
+		std::chrono::steady_clock::now() - started;
+	return elapsed.count() - stepping_ns;
+}
+
+void thread_entry()
+{
+	/*
+	   first code run on a task's stack
+	*/
+	running->function(running->parameters);
+	running->removed = true;
+	schedule();
+}
+} // namespace
+
+void sim::reset()
+{
+	/*
+	   clears every motor and task and restarts the
+	   clock, from the thread that turned scheduling on
+	*/
+	for(auto& state : motors)
+	{
+		state = MotorState();
+	}
+	for(auto& state : imus)
+	{
+		state = ImuState();
+	}
+	now = 0;
+	stepping_ns = 0;
+	started = std::chrono::steady_clock::now();
+	code_ns_at_step = 0;
+	for(Thread* thread : threads)
+	{
+		thread->removed = true;
+	}
+	threads.clear();
+	main_thread = Thread();
+	running = nullptr;
+	time_limit = TIMEOUT_MAX;
+	limit_expired = nullptr;
+	drive_declared = false;
+	drive_state = DriveState();
+	set_noise(0, 0, 0, 0);
+	battery_voltage = 12800;
+	competition_disabled = false;
+	std::fill(std::begin(analog_inputs), std::end(analog_inputs), 0);
+	std::fill(std::begin(digital_inputs), std::end(digital_inputs), false);
+	vision_count = 0;
+}
+
+void sim::step(std::uint32_t ms)
+{
+	/*
+	   advances the clock 1ms at a time, each motor
+	   approaching the speed its voltage asks for
+	   less what friction takes
+	*/
+	auto start = std::chrono::steady_clock::now();
+	const double dt = 0.001;
+	for(std::uint32_t i = 0; i < ms; i++)
+	{
+		for(auto& state : motors)
+		{
+			double limit = battery_voltage;
+			double voltage =
+				std::max(-limit, std::min(limit, (double)state.voltage));
+			double driving =
+				std::max(0.0, std::abs(voltage) - state.friction);
+			double target = std::copysign(driving, voltage) / 12000 *
+							state.free_speed * state.speed_scale;
+			state.velocity +=
+				(target - state.velocity) * dt / state.time_constant;
+			state.position += state.velocity * 6 * dt;
+			state.travel += state.velocity * 6 * dt;
+		}
+		if(drive_declared)
+		{
+			move_drive(dt);
+		}
+		now++;
+
+		if(now >= time_limit && limit_expired != nullptr)
+		{
+			void (*expired)() = limit_expired;
+			limit_expired = nullptr;
+			expired();
+		}
+	}
+	std::chrono::duration<double, std::nano> elapsed =
+		std::chrono::steady_clock::now() - start;
+	stepping_ns += elapsed.count();
+	code_ns_at_step = code_ns();
+}
+
+std::uint32_t sim::time()
+{
+	/*
+	   simulated milliseconds since reset
+	*/
+	return now;
+}
+
+double sim::step_time()
+{
+	/*
+	   wall clock ns spent in step() since reset, so
+	   a benchmark can leave the sim's share out
+	*/
+	return stepping_ns;
+}
+
+sim::MotorState& sim::motor(std::uint8_t port)
+{
+	/*
+	   state behind a motor port, 1 to 21
+	*/
+	return motors[std::min<std::uint8_t>(port, 21)];
+}
+
+sim::ImuState& sim::imu(std::uint8_t port)
+{
+	/*
+	   state behind an inertial sensor port, 1 to 21
+	*/
+	return imus[std::min<std::uint8_t>(port, 21)];
+}
+
+void sim::set_battery(double millivolts)
+{
+	/*
+	   voltage the motor outputs are limited to
+	*/
+	battery_voltage = millivolts;
+}
+
+void sim::set_disabled(bool disabled)
+{
+	/*
+	   competition state seen by the robot code
+	*/
+	competition_disabled = disabled;
+}
+
+void sim::set_analog(pros::controller_analog_e_t channel, int value)
+{
+	/*
+	   stick position the controller reports
+	*/
+	analog_inputs[channel] = value;
+}
+
+void sim::set_digital(pros::controller_digital_e_t button, bool held)
+{
+	/*
+	   button state the controller reports
+	*/
+	digital_inputs[button] = held;
+}
+
+void sim::set_vision(const pros::vision_object_s_t* objects, std::size_t count)
+{
+	/*
+	   objects the vision sensor sees, biggest first
+	*/
+	vision_count = std::min(count, std::size(vision_objects));
+	std::copy(objects, objects + vision_count, vision_objects);
+}
+
+void sim::set_scheduling(bool enabled)
+{
+	/*
+	   runs the tasks from now on, with the caller as
+	   the main task, or stops running them.  Call it
+	   from the thread that runs the sim.
+	*/
+	running = enabled ? &main_thread : nullptr;
+	main_thread.wake = now;
+}
+
+void sim::set_time_limit(std::uint32_t ms, void (*expired)())
+{
+	/*
+	   calls expired, once, when the clock reaches ms
+	*/
+	time_limit = ms;
+	limit_expired = expired;
+}
+
+void sim::set_drive(std::uint8_t left_port, std::uint8_t right_port,
+					std::uint8_t imu_port, double wheel_diameter,
+					double track_width)
+{
+	/*
+	   the two motors that drive the robot and the
+	   sensor that turns with it, the robot starts at
+	   the origin facing along x
+	*/
+	drive_declared = true;
+	drive_ports[0] = std::min<std::uint8_t>(left_port, 21);
+	drive_ports[1] = std::min<std::uint8_t>(right_port, 21);
+	drive_ports[2] = std::min<std::uint8_t>(imu_port, 21);
+	wheel_circumference = M_PI * wheel_diameter;
+	drive_track_width = track_width;
+	drive_state = DriveState();
+}
+
+sim::DriveState& sim::drive()
+{
+	/*
+	   where the declared drive really is
+	*/
+	return drive_state;
+}
+
+void sim::set_noise(double encoder, double gyro, double bias,
+					std::uint32_t seed)
+{
+	/*
+	   standard deviation of each encoder reading
+	   (degrees) and gyro sample (degrees per second),
+	   and the gyro's constant drift
+	*/
+	encoder_noise = encoder;
+	gyro_noise = gyro;
+	gyro_bias = bias;
+	noise_source.seed(seed);
+}
+
+namespace pros
+{
+// kernel
+std::uint32_t c::millis()
+{
+	return now;
+}
+
+void c::delay(const std::uint32_t milliseconds)
+{
+	wait_until(now + milliseconds);
+}
+
+task_t c::task_get_current()
+{
+	return running;
+}
+
+std::uint32_t c::task_notify(task_t task)
+{
+	if(task != nullptr)
+	{
+		Thread* thread = static_cast<Thread*>(task);
+		thread->notifications++;
+		// like FreeRTOS, a waiting task of higher priority runs at once
+		if(running != nullptr && thread->waiting && !thread->removed &&
+		   thread->priority > running->priority)
+		{
+			schedule();
+		}
+	}
+	return 1;
+}
+
+std::uint32_t c::task_notify_take(bool clear_on_exit,
+								  std::uint32_t timeout)
+{
+	if(running == nullptr)
+	{
+		// nothing else runs, so every wait times out
+		sim::step(timeout == TIMEOUT_MAX ? 0 : timeout);
+		return 0;
+	}
+
+	if(running->notifications == 0)
+	{
+		running->waiting = true;
+		running->wake = timeout == TIMEOUT_MAX ? TIMEOUT_MAX : now + timeout;
+		schedule();
+		running->waiting = false;
+	}
+	std::uint32_t value = running->notifications;
+	if(value > 0)
+	{
+		running->notifications = clear_on_exit ? 0 : value - 1;
+	}
+	return value;
+}
+
+bool c::task_notify_clear(task_t task)
+{
+	if(task != nullptr)
+	{
+		static_cast<Thread*>(task)->notifications = 0;
+	}
+	return true;
+}
+
+Task::Task(task_fn_t function, void* parameters, std::uint32_t prio,
+		   std::uint16_t stack_depth, const char* name)
+{
+	// first runs when the thread making it waits
+	Thread* thread = new Thread();
+	thread->function = function;
+	thread->parameters = parameters;
+	thread->priority = prio;
+	thread->wake = now;
+	thread->stack.reset(new char[TASK_STACK_SIZE]);
+	getcontext(&thread->context);
+	thread->context.uc_stack.ss_sp = thread->stack.get();
+	thread->context.uc_stack.ss_size = TASK_STACK_SIZE;
+	thread->context.uc_link = nullptr;
+	makecontext(&thread->context, thread_entry, 0);
+
+	task = thread;
+	threads.push_back(thread);
+}
+
+void Task::remove()
+{
+	Thread* thread = static_cast<Thread*>(task);
+	thread->removed = true;
+	if(thread == running)
+	{
+		schedule();
+	}
+}
+
+std::uint32_t Task::notify()
+{
+	return c::task_notify(task);
+}
+
+void Task::delay_until(std::uint32_t* const prev_time,
+					   const std::uint32_t delta)
+{
+	*prev_time += delta;
+	wait_until(*prev_time);
+}
+
+Mutex::Mutex() : mutex(nullptr)
+{
+}
+
+bool Mutex::take(std::uint32_t timeout)
+{
+	return true;
+}
+
+bool Mutex::give()
+{
+	return true;
+}
+
+std::int32_t battery::get_voltage()
+{
+	return battery_voltage;
+}
+
+double battery::get_capacity()
+{
+	return 100;
+}
+
+std::uint8_t competition::is_disabled()
+{
+	return competition_disabled;
+}
+
+// brain screen
+bool lcd::initialize()
+{
+	return true;
+}
+
+bool c::lcd_print(std::int16_t line, const char* fmt, ...)
+{
+	return true;
+}
+
+std::uint8_t lcd::read_buttons()
+{
+	return 0;
+}
+
+// controller
+Controller::Controller(controller_id_e_t id) : _id(id)
+{
+}
+
+std::int32_t Controller::get_analog(controller_analog_e_t channel)
+{
+	return analog_inputs[channel];
+}
+
+std::int32_t Controller::get_digital(controller_digital_e_t button)
+{
+	return digital_inputs[button];
+}
+
+std::int32_t Controller::set_text(std::uint8_t line, std::uint8_t col,
+								  const char* str)
+{
+	return 1;
+}
+
+std::int32_t Controller::rumble(const char* rumble_pattern)
+{
+	return 1;
+}
+
+// inertial sensor
+std::int32_t Imu::reset() const
+{
+	return 1;
+}
+
+double Imu::get_rotation() const
+{
+	return sim::imu(_port).rotation;
+}
+
+double Imu::get_heading() const
+{
+	double heading = std::fmod(get_rotation(), 360);
+	return heading < 0 ? heading + 360 : heading;
+}
+
+c::quaternion_s_t Imu::get_quaternion() const
+{
+	double half = -get_rotation() * M_PI / 360;
+	return c::quaternion_s_t{ 0, 0, std::sin(half), std::cos(half) };
+}
+
+c::euler_s_t Imu::get_euler() const
+{
+	return c::euler_s_t{ 0, 0, get_yaw() };
+}
+
+double Imu::get_pitch() const
+{
+	return 0;
+}
+
+double Imu::get_roll() const
+{
+	return 0;
+}
+
+double Imu::get_yaw() const
+{
+	double heading = get_heading();
+	return heading > 180 ? heading - 360 : heading;
+}
+
+c::imu_gyro_s_t Imu::get_gyro_rate() const
+{
+	return c::imu_gyro_s_t{ 0, 0, sim::imu(_port).gyro_rate };
+}
+
+c::imu_accel_s_t Imu::get_accel() const
+{
+	return c::imu_accel_s_t{ sim::imu(_port).acceleration, 0, 1 };
+}
+
+c::imu_status_e_t Imu::get_status() const
+{
+	return is_calibrating() ? c::E_IMU_STATUS_CALIBRATING
+							: static_cast<c::imu_status_e_t>(0);
+}
+
+bool Imu::is_calibrating() const
+{
+	return sim::imu(_port).calibrating;
+}
+
+// vision sensor
+Vision::Vision(std::uint8_t port, vision_zero_e_t zero_point) : _port(port)
+{
+}
+
+std::int32_t Vision::read_by_sig(const std::uint32_t size_id,
+								 const std::uint32_t sig_id,
+								 const std::uint32_t object_count,
+								 vision_object_s_t* const object_arr) const
+{
+	std::int32_t count = 0;
+	for(std::size_t i = size_id; i < vision_count; i++)
+	{
+		if(vision_objects[i].signature == sig_id && count < object_count)
+		{
+			object_arr[count++] = vision_objects[i];
+		}
+	}
+	return count == 0 ? PROS_ERR : count;
+}
+
+std::int32_t Vision::set_zero_point(vision_zero_e_t zero_point) const
+{
+	return 1;
+}
+
+// motors
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset,
+			 const bool reverse,
+			 const motor_encoder_units_e_t encoder_units)
+	: _port(port)
+{
+	sim::motor(port).free_speed = cartridge_speed(gearset);
+	sim::motor(port).reversed = reverse;
+}
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset,
+			 const bool reverse)
+	: Motor(port, gearset, reverse, E_MOTOR_ENCODER_DEGREES)
+{
+}
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset)
+	: Motor(port, gearset, false, E_MOTOR_ENCODER_DEGREES)
+{
+}
+
+Motor::Motor(const std::uint8_t port, const bool reverse)
+	: Motor(port, E_MOTOR_GEARSET_18, reverse, E_MOTOR_ENCODER_DEGREES)
+{
+}
+
+Motor::Motor(const std::uint8_t port)
+	: Motor(port, E_MOTOR_GEARSET_18, false, E_MOTOR_ENCODER_DEGREES)
+{
+}
+
+std::int32_t Motor::operator=(std::int32_t voltage) const
+{
+	return move(voltage);
+}
+
+std::int32_t Motor::move(std::int32_t voltage) const
+{
+	return move_voltage(voltage * 12000 / 127);
+}
+
+std::int32_t Motor::move_absolute(const double position,
+								  const std::int32_t velocity) const
+{
+	return move_velocity(position > get_position() ? velocity : -velocity);
+}
+
+std::int32_t Motor::move_relative(const double position,
+								  const std::int32_t velocity) const
+{
+	return move_velocity(position > 0 ? velocity : -velocity);
+}
+
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const
+{
+	auto& state = sim::motor(_port);
+	return move_voltage(velocity * 12000 / state.free_speed);
+}
+
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const
+{
+	auto& state = sim::motor(_port);
+	state.voltage = std::max(-12000, std::min(12000, voltage)) *
+					direction(state);
+	return 1;
+}
+
+std::int32_t Motor::modify_profiled_velocity(
+	const std::int32_t velocity) const
+{
+	return 1;
+}
+
+double Motor::get_target_position() const
+{
+	return 0;
+}
+
+std::int32_t Motor::get_target_velocity() const
+{
+	return 0;
+}
+
+double Motor::get_actual_velocity() const
+{
+	auto& state = sim::motor(_port);
+	return state.velocity * direction(state);
+}
+
+std::int32_t Motor::get_current_draw() const
+{
+	auto& state = sim::motor(_port);
+	double back_emf = state.velocity / state.free_speed * 12000;
+	double current =
+		std::abs(state.voltage - back_emf) / 12000 * STALL_CURRENT;
+	return std::min<double>(current, state.current_limit);
+}
+
+std::int32_t Motor::get_direction() const
+{
+	return get_actual_velocity() < 0 ? -1 : 1;
+}
+
+double Motor::get_efficiency() const
+{
+	return 100;
+}
+
+std::int32_t Motor::is_over_current() const
+{
+	return 0;
+}
+
+std::int32_t Motor::is_stopped() const
+{
+	return std::abs(sim::motor(_port).velocity) < 1;
+}
+
+std::int32_t Motor::get_zero_position_flag() const
+{
+	return 0;
+}
+
+std::uint32_t Motor::get_faults() const
+{
+	return 0;
+}
+
+std::uint32_t Motor::get_flags() const
+{
+	return 0;
+}
+
+std::int32_t Motor::get_raw_position(
+	std::uint32_t* const timestamp) const
+{
+	auto& state = sim::motor(_port);
+	if(timestamp)
+	{
+		*timestamp = now;
+	}
+	// 1800 counts per revolution of the 100rpm output, scaled by speed
+	double counts = 1800.0 * 100 / state.free_speed;
+	double position =
+		state.travel * direction(state) + gaussian(encoder_noise);
+	return std::lround(position / 360 * counts);
+}
+
+std::int32_t Motor::is_over_temp() const
+{
+	return 0;
+}
+
+double Motor::get_position() const
+{
+	auto& state = sim::motor(_port);
+	return state.position * direction(state) + gaussian(encoder_noise);
+}
+
+double Motor::get_power() const
+{
+	auto& state = sim::motor(_port);
+	return std::abs(state.voltage / 1000.0 * get_current_draw() / 1000.0);
+}
+
+double Motor::get_temperature() const
+{
+	return sim::motor(_port).temperature;
+}
+
+double Motor::get_torque() const
+{
+	return get_current_draw() / 2500.0 * 2.1;
+}
+
+std::int32_t Motor::get_voltage() const
+{
+	auto& state = sim::motor(_port);
+	return state.voltage * direction(state);
+}
+
+std::int32_t Motor::set_zero_position(const double position) const
+{
+	auto& state = sim::motor(_port);
+	state.position = (get_position() - position) * direction(state);
+	return 1;
+}
+
+std::int32_t Motor::tare_position() const
+{
+	sim::motor(_port).position = 0;
+	return 1;
+}
+
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_current_limit(const std::int32_t limit) const
+{
+	sim::motor(_port).current_limit = limit;
+	return 1;
+}
+
+std::int32_t Motor::set_encoder_units(
+	const motor_encoder_units_e_t units) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset) const
+{
+	sim::motor(_port).free_speed = cartridge_speed(gearset);
+	return 1;
+}
+
+std::int32_t Motor::set_pos_pid(const motor_pid_s_t pid) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_pos_pid_full(const motor_pid_full_s_t pid) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_vel_pid(const motor_pid_s_t pid) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_vel_pid_full(const motor_pid_full_s_t pid) const
+{
+	return 1;
+}
+
+std::int32_t Motor::set_reversed(const bool reverse) const
+{
+	sim::motor(_port).reversed = reverse;
+	return 1;
+}
+
+std::int32_t Motor::set_voltage_limit(const std::int32_t limit) const
+{
+	return 1;
+}
+
+motor_brake_mode_e_t Motor::get_brake_mode() const
+{
+	return E_MOTOR_BRAKE_COAST;
+}
+
+std::int32_t Motor::get_current_limit() const
+{
+	return sim::motor(_port).current_limit;
+}
+
+motor_encoder_units_e_t Motor::get_encoder_units() const
+{
+	return E_MOTOR_ENCODER_DEGREES;
+}
+
+motor_gearset_e_t Motor::get_gearing() const
+{
+	switch(sim::motor(_port).free_speed)
+	{
+		case 100:
+			return E_MOTOR_GEARSET_36;
+		case 600:
+			return E_MOTOR_GEARSET_06;
+		default:
+			return E_MOTOR_GEARSET_18;
+	}
+}
+
+motor_pid_full_s_t Motor::get_pos_pid() const
+{
+	return motor_pid_full_s_t();
+}
+
+motor_pid_full_s_t Motor::get_vel_pid() const
+{
+	return motor_pid_full_s_t();
+}
+
+std::int32_t Motor::is_reversed() const
+{
+	return sim::motor(_port).reversed;
+}
+
+std::int32_t Motor::get_voltage_limit() const
+{
+	return 0;
+}
+
+std::uint8_t Motor::get_port() const
+{
+	return _port;
+}
+} // namespace pros
+
+extern "C" std::uint64_t vexSystemHighResTimeGet()
+{
+	/*
+	   the V5 runtime's microsecond timer: the sim's
+	   clock, with the host's time running robot code
+	   since the last step added below the
+	   millisecond so the code can be timed.  Unlike
+	   everything else it differs from run to run
+	*/
+	double since_step = (code_ns() - code_ns_at_step) / 1000;
+	return now * 1000ull + static_cast<std::uint64_t>(
+							   std::min(std::max(since_step, 0.0), 999.0));
+}
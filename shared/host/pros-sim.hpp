@@ -0,0 +1,90 @@
+#ifndef PROS_SIM_HPP
+#define PROS_SIM_HPP
+
+/*
+	Host side stand-in for the PROS kernel, so the
+	shared robot code can be compiled and run on a
+	desktop for benchmarks and simulation.
+
+	pros::Motor is backed by a simple first order
+	motor model per port.  The clock only moves
+	when delay() is called or the caller steps it,
+	so runs are repeatable.  Tasks are created but
+	never scheduled and the caller drives the loops,
+	unless scheduling is turned on.  Then every task
+	runs on its own stack and they take turns, the
+	highest priority ready task running until it
+	waits or notifies a waiting task above it, and
+	the clock moves once all of them wait.  A run is
+	the same every time for the same inputs, there
+	are no threads.  Only the microsecond timer
+	differs, it adds the host's time running robot
+	code to the clock so that code can be timed.
+
+	A drive can be declared so the robot's position
+	on the field and the inertial sensor follow the
+	two drive motors.
+*/
+
+namespace sim
+{
+struct MotorState
+{
+	int voltage = 0;
+	double velocity = 0; // rpm at the output shaft
+	double position = 0; // degrees
+	double travel = 0; // degrees since power on, taring doesn't move it
+	int current_limit = 2500;
+	bool reversed = false;
+	int free_speed = 200;
+	double temperature = 25;
+	// fraction of the cartridge's free speed this motor reaches
+	double speed_scale = 1;
+	double time_constant = 0.08; // seconds
+	int friction = 0; // mV lost before the motor moves
+};
+
+// inertial sensor readings, clockwise positive like the real sensor
+struct ImuState
+{
+	double rotation = 0; // degrees
+	double gyro_rate = 0; // degrees per second about z
+	double acceleration = 0; // g along x
+	bool calibrating = false;
+};
+
+// where the declared drive really is, counterclockwise positive
+struct DriveState
+{
+	double x = 0; // inches
+	double y = 0; // inches
+	double heading = 0; // radians
+	double velocity = 0; // inches per second
+};
+
+void reset();
+void step(std::uint32_t ms);
+std::uint32_t time();
+double step_time();
+MotorState& motor(std::uint8_t port);
+ImuState& imu(std::uint8_t port);
+void set_battery(double millivolts);
+void set_disabled(bool disabled);
+void set_analog(pros::controller_analog_e_t channel, int value);
+void set_digital(pros::controller_digital_e_t button, bool held);
+void set_vision(const pros::vision_object_s_t* objects, std::size_t count);
+
+// tasks
+void set_scheduling(bool enabled);
+void set_time_limit(std::uint32_t ms, void (*expired)());
+
+// drive and sensor noise
+void set_drive(std::uint8_t left_port, std::uint8_t right_port,
+			   std::uint8_t imu_port, double wheel_diameter,
+			   double track_width);
+DriveState& drive();
+void set_noise(double encoder, double gyro, double bias,
+			   std::uint32_t seed);
+} // namespace sim
+
+#endif
@@ -0,0 +1,321 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "script-format.hpp"
+
+/*
+   Compiles a text autonomous script into the format
+   AutonScript loads from the sd card.
+
+     script-compile <script.auto> <script.bin>
+
+   One instruction per line, # starts a comment:
+
+     drive move 2000         move_pid 2000, full speed
+     drive move 2500 80      move_pid 2500, speed 80
+     drive turn -600         turn_pid -600
+     scooper run 127         run at 127
+     scooper stop
+     deploy 3000             calls the action "deploy"
+     wait 250                waits 250ms
+     ramp reach 1500 3000    waits until the ramp reaches
+                             1500, at most 3000ms
+     scooper speed 150 500   until it runs at 150rpm
+     ramp stall 2000         until it stalls
+     parallel                the lines up to end run at
+       drive move 1000       the same time, each using a
+       arm_to 1750           different group
+     end
+
+   Group and action names are whatever the robot
+   program added to its AutonScript.  reach, speed
+   and stall wait on its SensorMonitor, which has
+   to sample the group.
+*/
+
+namespace
+{
+struct Compiler
+{
+	const char* path;
+	int line = 0;
+	std::vector<std::string> names;
+	std::vector<script::Instruction> instructions;
+	// index of the open parallel instruction, -1 outside of a block
+	int block = -1;
+
+	void fail(const std::string& message)
+	{
+		std::fprintf(stderr, "%s:%d: %s\n", path, line, message.c_str());
+		std::exit(1);
+	}
+
+	int number(const std::string& text, int min, int max)
+	{
+		char* end;
+		long value = std::strtol(text.c_str(), &end, 10);
+		if(text.empty() || *end != '\0')
+		{
+			fail("expected a number, got '" + text + "'");
+		}
+		if(value < min || value > max)
+		{
+			fail(text + " is outside " + std::to_string(min) + " to " +
+				 std::to_string(max));
+		}
+		return value;
+	}
+
+	std::uint8_t name(const std::string& text)
+	{
+		if(text.size() > script::name_length)
+		{
+			fail("name '" + text + "' is longer than " +
+				 std::to_string(script::name_length) + " characters");
+		}
+		for(std::size_t i = 0; i < names.size(); i++)
+		{
+			if(names[i] == text)
+			{
+				return i;
+			}
+		}
+		if(names.size() == script::max_names)
+		{
+			fail("more than " + std::to_string(script::max_names) + " names");
+		}
+		names.push_back(text);
+		return names.size() - 1;
+	}
+
+	void emit(script::Op op, std::uint8_t target, int a, int b)
+	{
+		if(instructions.size() == script::max_instructions)
+		{
+			fail("more than " + std::to_string(script::max_instructions) +
+				 " instructions");
+		}
+		instructions.push_back(script::Instruction{
+			op, target, static_cast<std::int16_t>(a),
+			static_cast<std::int16_t>(b) });
+	}
+
+	void close_block()
+	{
+		std::size_t count = instructions.size() - block - 1;
+		if(count == 0)
+		{
+			fail("empty parallel block");
+		}
+		if(count > script::max_branches)
+		{
+			fail("a parallel block runs at most " +
+				 std::to_string(script::max_branches) + " lines");
+		}
+		for(std::size_t i = block + 1; i < instructions.size(); i++)
+		{
+			for(std::size_t j = block + 1; j < i; j++)
+			{
+				bool groups = instructions[i].op <= script::Op::turn &&
+							  instructions[j].op <= script::Op::turn;
+				if(groups && instructions[i].target == instructions[j].target)
+				{
+					fail("'" + names[instructions[i].target] +
+						 "' is used twice in one parallel block");
+				}
+			}
+		}
+		instructions[block].a = count;
+		block = -1;
+	}
+
+	void statement(const std::vector<std::string>& words)
+	{
+		const std::string& first = words[0];
+		std::size_t count = words.size();
+
+		if(first == "wait")
+		{
+			if(count != 2)
+			{
+				fail("usage: wait <ms>");
+			}
+			emit(script::Op::wait, 0, number(words[1], 0, INT16_MAX), 0);
+		}
+		else if(first == "parallel")
+		{
+			if(count != 1 || block >= 0)
+			{
+				fail(block >= 0 ? "parallel blocks can't be nested"
+								: "usage: parallel");
+			}
+			block = instructions.size();
+			emit(script::Op::parallel, 0, 0, 0);
+		}
+		else if(first == "end")
+		{
+			if(count != 1 || block < 0)
+			{
+				fail(block < 0 ? "end without parallel" : "usage: end");
+			}
+			close_block();
+		}
+		else if(count >= 2 && words[1] == "run")
+		{
+			if(count != 3)
+			{
+				fail("usage: <group> run <speed>");
+			}
+			emit(script::Op::run, name(first), number(words[2], -127, 127),
+				 0);
+		}
+		else if(count >= 2 && words[1] == "stop")
+		{
+			if(count != 2)
+			{
+				fail("usage: <group> stop");
+			}
+			emit(script::Op::stop, name(first), 0, 0);
+		}
+		else if(count >= 2 && (words[1] == "move" || words[1] == "turn"))
+		{
+			if(count != 3 && count != 4)
+			{
+				fail("usage: <group> " + words[1] + " <ticks> [speed]");
+			}
+			script::Op op =
+				words[1] == "move" ? script::Op::move : script::Op::turn;
+			int speed = count == 4 ? number(words[3], 1, 127) : 127;
+			emit(op, name(first), number(words[2], INT16_MIN, INT16_MAX),
+				 speed);
+		}
+		else if(count >= 2 && (words[1] == "reach" || words[1] == "speed"))
+		{
+			bool reach = words[1] == "reach";
+			if(count != 4)
+			{
+				fail("usage: <group> " + words[1] +
+					 (reach ? " <ticks> <ms>" : " <rpm> <ms>"));
+			}
+			int value = reach ? number(words[2], INT16_MIN, INT16_MAX)
+							  : number(words[2], 0, 600);
+			emit(reach ? script::Op::reach : script::Op::speed, name(first),
+				 value, number(words[3], 0, INT16_MAX));
+		}
+		else if(count >= 2 && words[1] == "stall")
+		{
+			if(count != 3)
+			{
+				fail("usage: <group> stall <ms>");
+			}
+			emit(script::Op::stall, name(first),
+				 number(words[2], 0, INT16_MAX), 0);
+		}
+		else
+		{
+			if(count > 2)
+			{
+				fail("usage: <action> [value]");
+			}
+			int value =
+				count == 2 ? number(words[1], INT16_MIN, INT16_MAX) : 0;
+			emit(script::Op::call, name(first), value, 0);
+		}
+	}
+
+	void compile(std::istream& in)
+	{
+		std::string text;
+		while(std::getline(in, text))
+		{
+			line++;
+			text = text.substr(0, text.find('#'));
+
+			std::istringstream stream(text);
+			std::vector<std::string> words;
+			std::string word;
+			while(stream >> word)
+			{
+				words.push_back(word);
+			}
+			if(!words.empty())
+			{
+				statement(words);
+			}
+		}
+		if(block >= 0)
+		{
+			fail("parallel without end");
+		}
+	}
+
+	std::vector<std::uint8_t> encode()
+	{
+		std::vector<std::uint8_t> data(script::magic,
+									   script::magic + sizeof(script::magic));
+		data.push_back(script::version);
+		data.push_back(names.size());
+		data.push_back(instructions.size() & 0xff);
+		data.push_back(instructions.size() >> 8);
+
+		for(const std::string& text : names)
+		{
+			std::string padded = text;
+			padded.resize(script::name_length, '\0');
+			data.insert(data.end(), padded.begin(), padded.end());
+		}
+		for(const script::Instruction& instruction : instructions)
+		{
+			data.push_back(static_cast<std::uint8_t>(instruction.op));
+			data.push_back(instruction.target);
+			data.push_back(instruction.a & 0xff);
+			data.push_back((instruction.a >> 8) & 0xff);
+			data.push_back(instruction.b & 0xff);
+			data.push_back((instruction.b >> 8) & 0xff);
+		}
+
+		return data;
+	}
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+	if(argc != 3)
+	{
+		std::fprintf(stderr, "usage: %s <script.auto> <script.bin>\n",
+					 argv[0]);
+		return 2;
+	}
+
+	std::ifstream in(argv[1]);
+	if(!in)
+	{
+		std::fprintf(stderr, "%s: can't read\n", argv[1]);
+		return 1;
+	}
+
+	Compiler compiler;
+	compiler.path = argv[1];
+	compiler.compile(in);
+	std::vector<std::uint8_t> data = compiler.encode();
+
+	std::ofstream out(argv[2], std::ios::binary);
+	out.write(reinterpret_cast<const char*>(data.data()), data.size());
+	if(!out)
+	{
+		std::fprintf(stderr, "%s: can't write\n", argv[2]);
+		return 1;
+	}
+
+	std::printf("%s: %zu instructions, %zu names, %zu bytes\n", argv[2],
+				compiler.instructions.size(), compiler.names.size(),
+				data.size());
+	return 0;
+}
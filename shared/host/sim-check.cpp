@@ -0,0 +1,1231 @@
+#include "main.h"
+#include "pros-sim.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+   Checks the robot code on the host, mostly
+   against the sim, each check showing in numbers
+   that a mechanism does what it is meant to and
+   failing if it doesn't.
+
+   Each check runs in a process forked from the
+   freshly loaded program, so none sees what
+   another left behind.
+
+   usage: sim-check [check...]
+*/
+
+namespace
+{
+// mV a motor loses to friction, as in auton-sweep.cpp
+const int FRICTION = 400;
+const std::uint32_t SAMPLE_INTERVAL = 10;
+
+struct Check
+{
+	const char* name;
+	bool (*run)();
+};
+
+void sample(void* param)
+{
+	/*
+	   the first motor's position every sample
+	   interval, the robot's trajectory
+	*/
+	std::vector<double>* positions = static_cast<std::vector<double>*>(param);
+	std::uint32_t now = pros::millis();
+	while(true)
+	{
+		positions->push_back(sim::motor(1).position);
+		pros::Task::delay_until(&now, SAMPLE_INTERVAL);
+	}
+}
+
+double trajectory_difference(const std::vector<double>& run,
+							 const std::vector<double>& reference)
+{
+	/*
+	   the furthest two trajectories get apart,
+	   degrees, the shorter one held at its end
+	*/
+	double difference = 0;
+	std::size_t length = std::max(run.size(), reference.size());
+	for(std::size_t i = 0; i < length; i++)
+	{
+		double a = run[std::min(i, run.size() - 1)];
+		double b = reference[std::min(i, reference.size() - 1)];
+		difference = std::max(difference, std::abs(a - b));
+	}
+	return difference;
+}
+
+std::vector<double> battery_move(double battery, bool compensated)
+{
+	/*
+	   a 2000 degree move_pid of a two motor drive
+	   on a battery, sampled from the start
+	*/
+	sim::reset();
+	MotorGroup::set_voltage_scale(1);
+	sim::set_battery(battery);
+	sim::set_scheduling(true);
+
+	pros::Motor left(1, false), right(2, true);
+	MotorGroup drive({ &left, &right }, {});
+	sim::motor(1).friction = FRICTION;
+	sim::motor(2).friction = FRICTION;
+	drive.set_velocity_filter(VelocityFilter::dema, 0.5, 0.3);
+	drive.set_pid_constants(0.25, 0.10, 5.0);
+
+	VoltageCompensator compensator(11000);
+	if(compensated)
+	{
+		compensator.start();
+	}
+	std::vector<double> positions;
+	pros::Task sampler(sample, &positions, TASK_PRIORITY_MAX,
+					   TASK_STACK_DEPTH_DEFAULT, "sample");
+	drive.move_pid(2000);
+	sampler.remove();
+	return positions;
+}
+
+bool battery_check()
+{
+	/*
+	   the same move on batteries from 11V to a full
+	   12.8V must follow the same trajectory once
+	   compensated, and a sagged 10.5V one is shown
+	*/
+	const double batteries[] = { 12800, 12000, 11500, 11000, 10500 };
+	std::vector<double> reference[2];
+	bool passed = true;
+	std::printf("%8s %22s %22s\n", "", "uncompensated", "compensated");
+	std::printf("%8s %10s %11s %10s %11s\n", "battery", "time (ms)",
+				"apart (deg)", "time (ms)", "apart (deg)");
+	for(double battery : batteries)
+	{
+		std::printf("%6.0fmV", battery);
+		for(int compensated = 0; compensated < 2; compensated++)
+		{
+			std::vector<double> run = battery_move(battery, compensated);
+			if(reference[compensated].empty())
+			{
+				reference[compensated] = run;
+			}
+			double apart = trajectory_difference(run, reference[compensated]);
+			std::printf(" %10zu %11.2f", run.size() * SAMPLE_INTERVAL, apart);
+			if(compensated && battery >= 11000)
+			{
+				passed = passed && apart == 0;
+			}
+		}
+		std::printf("\n");
+	}
+	return passed;
+}
+
+// a lookup and the speeds it should give, forward 0 for none
+struct Expected
+{
+	int position;
+	int forward;
+	int reverse;
+};
+
+bool check_lookups(const char* name, SpeedMap& map,
+				   std::initializer_list<Expected> expected)
+{
+	/*
+	   prints a map's lookups against the speeds
+	   they should give
+	*/
+	bool passed = true;
+	std::printf("%-22s", name);
+	for(const Expected& lookup : expected)
+	{
+		int forward = 0, reverse = 0;
+		map.lookup(lookup.position, forward, reverse);
+		bool same = forward == lookup.forward && reverse == lookup.reverse;
+		std::printf(" %d:%d%s", lookup.position, forward, same ? "" : "!");
+		passed = passed && same;
+	}
+	std::printf("\n");
+	return passed;
+}
+
+bool speed_map_check()
+{
+	/*
+	   stacked thresholds keep their speeds up to
+	   their edges and give way to the one around
+	   them, on a group whose speeds are 80 and -60.
+	   Wrong lookups are marked with a !.
+	*/
+	bool passed = true;
+
+	SpeedMap adjacent;
+	adjacent.set_speeds(80, -60);
+	adjacent.add_zone(1500, 2500, 35, -60);
+	adjacent.add_zone(2501, 3000, 20, -60);
+	passed &= check_lookups("adjacent", adjacent,
+							{ { 1499, 0, 0 },
+							  { 1500, 35, -60 },
+							  { 2500, 35, -60 },
+							  { 2501, 20, -60 },
+							  { 3000, 20, -60 },
+							  { 3001, 0, 0 } });
+
+	SpeedMap nested;
+	nested.set_speeds(80, -60);
+	nested.add_zone(1000, 4000, 50, -50);
+	nested.add_zone(2000, 2010, 10, -10);
+	passed &= check_lookups("nested", nested,
+							{ { 1000, 50, -50 },
+							  { 1999, 50, -50 },
+							  { 2000, 10, -10 },
+							  { 2010, 10, -10 },
+							  { 2011, 50, -50 },
+							  { 4000, 50, -50 } });
+
+	SpeedMap nested_first;
+	nested_first.set_speeds(80, -60);
+	nested_first.add_zone(2000, 2010, 10, -10);
+	nested_first.add_zone(1000, 4000, 50, -50);
+	passed &= check_lookups("nested, inner first", nested_first,
+							{ { 1999, 50, -50 },
+							  { 2000, 10, -10 },
+							  { 2010, 10, -10 },
+							  { 2011, 50, -50 } });
+
+	SpeedMap overlapping;
+	overlapping.set_speeds(80, -60);
+	overlapping.add_zone(1000, 2000, 30, -60);
+	overlapping.add_zone(1500, 2500, 40, -60);
+	overlapping.add_zone(2600, 2700, 20, -60);
+	passed &= check_lookups("overlapping", overlapping,
+							{ { 1499, 30, -60 },
+							  { 1500, 40, -60 },
+							  { 2500, 40, -60 },
+							  { 2550, 80, -60 },
+							  { 2600, 20, -60 } });
+
+	SpeedMap wide;
+	wide.set_speeds(80, -60);
+	wide.add_point(0, 80, -60);
+	wide.add_point(100000, 80, -60);
+	wide.add_zone(50000, 50002, 5, -5);
+	passed &= check_lookups("narrow in a wide map", wide,
+							{ { 49999, 80, -60 },
+							  { 50000, 5, -5 },
+							  { 50002, 5, -5 },
+							  { 50003, 80, -60 } });
+
+	// the ramp's ease into stacking, with a zone where it lets go
+	SpeedMap ramp;
+	ramp.set_speeds(80, -60);
+	ramp.add_point(1000, 80, -60);
+	ramp.add_point(1500, 35, -60);
+	ramp.add_point(2500, 35, -60);
+	ramp.add_point(2501, 80, -60);
+	ramp.add_zone(2400, 2500, 15, -60);
+	passed &= check_lookups("breakpoints and a zone", ramp,
+							{ { 999, 0, 0 },
+							  { 1250, 58, -60 },
+							  { 1500, 35, -60 },
+							  { 2399, 35, -60 },
+							  { 2400, 15, -60 },
+							  { 2501, 80, -60 } });
+	return passed;
+}
+
+// how the ramp went through the stacking range, times in ms
+struct RampWatch
+{
+	std::uint32_t start;
+	std::uint32_t entered;
+	std::uint32_t left;
+	double speed; // the fastest it went there, rpm
+};
+
+RampWatch ramp_watch;
+
+void watch_ramp(void* param)
+{
+	/*
+	   keeps ramp_watch while the ramp moves
+	*/
+	while(true)
+	{
+		int position = ramp.get_average_position();
+		std::uint32_t now = pros::millis() - ramp_watch.start;
+		if(position >= 1500 && ramp_watch.entered == 0)
+		{
+			ramp_watch.entered = now;
+		}
+		if(position >= 2500 && ramp_watch.left == 0)
+		{
+			ramp_watch.left = now;
+		}
+		if(position >= 1500 && position <= 2500)
+		{
+			double speed = std::abs(sim::motor(3).velocity);
+			ramp_watch.speed = std::max(ramp_watch.speed, speed);
+		}
+		pros::delay(1);
+	}
+}
+
+void lower_ramp()
+{
+	/*
+	   lets the ramp stop and puts it back down
+	*/
+	ramp.stop();
+	pros::delay(500);
+	ramp.clear_encoders();
+	ramp_watch = RampWatch{ pros::millis(), 0, 0, 0 };
+}
+
+void print_ramp(const char* name, std::uint32_t time)
+{
+	/*
+	   one row of the comparison
+	*/
+	std::printf("%-10s %9u %12u %10u %15.1f\n", name, ramp_watch.entered,
+				ramp_watch.left - ramp_watch.entered, time, ramp_watch.speed);
+}
+
+void deploy_in_task(void* param)
+{
+	/*
+	   an autonomous that deploys, to be stopped
+	   partway
+	*/
+	deploy.run(deploy.get_timeout());
+}
+
+bool deploy_check()
+{
+	/*
+	   the deploy against the driver holding x, the
+	   ramp following the speed map, on the robot as
+	   config/main.cpp sets it up.  The deploy must
+	   get to the stack sooner, go through it no
+	   faster and still be done sooner.  Then a deploy whose caller is stopped
+	   partway must still finish and give the ramp
+	   back.
+	*/
+	for(std::uint8_t port : { 3, 4, 12, 13 })
+	{
+		sim::motor(port).friction = FRICTION;
+	}
+	sim::set_scheduling(true);
+	initialize();
+	pros::Task watcher(watch_ramp, nullptr, TASK_PRIORITY_MAX,
+					   TASK_STACK_DEPTH_DEFAULT, "watch ramp");
+	lower_ramp();
+
+	std::printf("%-10s %9s %12s %10s %15s\n", "", "to 1500", "1500 to 2500",
+				"total (ms)", "stacking (rpm)");
+	std::uint32_t start = pros::millis();
+	while(ramp.get_average_position() < 3000 &&
+		  pros::millis() - start < 10000)
+	{
+		ramp.run(1, 0);
+		pros::delay(10);
+	}
+	RampWatch manual = ramp_watch;
+	std::uint32_t manual_total = pros::millis() - start;
+	print_ramp("holding x", manual_total);
+	lower_ramp();
+
+	start = pros::millis();
+	bool reached = deploy.run(deploy.get_timeout());
+	std::uint32_t total = pros::millis() - start;
+	print_ramp("deploy", total);
+	RampWatch deployed = ramp_watch;
+	lower_ramp();
+	std::printf("the profile takes %ums, times out after %ums%s\n",
+				deploy.get_duration(), deploy.get_timeout(),
+				reached ? "" : ", the deploy didn't reach the top");
+
+	pros::Task autonomous_task(deploy_in_task, nullptr, TASK_PRIORITY_DEFAULT,
+							   TASK_STACK_DEPTH_DEFAULT, "autonomous");
+	pros::delay(500);
+	autonomous_task.remove();
+	bool still_running = deploy.is_running();
+	start = pros::millis();
+	while(deploy.is_running() && pros::millis() - start < 10000)
+	{
+		pros::delay(10);
+	}
+	std::uint32_t released = pros::millis() - start;
+	bool given_back = !deploy.is_running();
+	deploy.trigger(100);
+	bool accepted = deploy.is_running();
+	std::printf("caller stopped 500ms in: deploy %s, ramp %s %ums later, "
+				"%s the next trigger\n",
+				still_running ? "carried on" : "stopped",
+				given_back ? "given back" : "still held", released,
+				accepted ? "took" : "ignored");
+
+	return reached && deployed.entered < manual.entered &&
+		   deployed.speed <= manual.speed && total <= manual_total &&
+		   still_running && given_back && accepted;
+}
+
+bool arm_check()
+{
+	/*
+	   the arm, geared and tuned as in
+	   config/main.cpp, sent below its rest position
+	   and back.  It must settle at every target and
+	   hold still there.  The sim has no gravity, so
+	   kG is left at 0, nor friction, which would
+	   hold the PD loop just short of the settle band
+	*/
+	sim::reset();
+	sim::set_scheduling(true);
+	pros::Motor left(5, true), right(6, false);
+	MotorGroup group({ &left, &right }, { 60, -40 });
+	group.set_velocity_filter(VelocityFilter::ema, 0.6);
+	ArmController arm(&group, 7.0, -40.0);
+	arm.set_gains(0.3, 0.05, 127.0 / 1200.0);
+	arm.set_limits(900, 3000);
+
+	const int targets[] = { 300, -300, -600, 0 };
+	bool passed = true;
+	std::printf("%8s %8s %10s %12s %12s\n", "target", "settled", "time (ms)",
+				"after (deg)", "1s on (deg)");
+	for(int target : targets)
+	{
+		std::uint32_t start = pros::millis();
+		bool settled = arm.move_to(target, 3000);
+		std::uint32_t time = pros::millis() - start;
+		double after = group.get_signed_position();
+		for(int i = 0; i < 100; i++)
+		{
+			arm.update();
+			pros::delay(ArmController::dT);
+		}
+		double held = group.get_signed_position();
+		std::printf("%8d %8s %10u %12.1f %12.1f\n", target,
+					settled ? "yes" : "no", time, after, held);
+		passed = passed && settled &&
+				 std::abs(held - target) < ArmController::settle_position;
+	}
+	return passed;
+}
+
+// how far apart a pair of motors got, degrees
+struct Spread
+{
+	double most;
+	double end;
+};
+
+Spread sync_spread(double kSync)
+{
+	/*
+	   a pair of mismatched motors run up, back and
+	   up again like the ramp, the furthest apart
+	   they got and where they ended apart
+	*/
+	sim::reset();
+	sim::set_scheduling(true);
+	pros::Motor left(3, false), right(4, true);
+	MotorGroup pair({ &left, &right }, { 127, -127 });
+	// one motor slower and stiffer than the other
+	sim::motor(3).friction = FRICTION;
+	sim::motor(4).friction = FRICTION * 2;
+	sim::motor(4).speed_scale = 0.85;
+	pair.set_sync(kSync);
+
+	Spread spread = { 0, 0 };
+	auto drive = [&](int speed, std::uint32_t time)
+	{
+		std::uint32_t now = pros::millis();
+		for(std::uint32_t t = 0; t < time; t += SAMPLE_INTERVAL)
+		{
+			pair.run(speed);
+			double apart = std::abs(left.get_position() - right.get_position());
+			spread.most = std::max(spread.most, apart);
+			pros::Task::delay_until(&now, SAMPLE_INTERVAL);
+		}
+	};
+	drive(127, 1500);
+	drive(-60, 1500);
+	drive(40, 1000);
+	pair.stop();
+	pros::delay(200);
+	spread.end = std::abs(left.get_position() - right.get_position());
+	std::printf("%6.1f %14.1f %14.1f\n", kSync, spread.most, spread.end);
+	return spread;
+}
+
+bool sync_check()
+{
+	/*
+	   paired motors, one 15% slower and with twice
+	   the friction, must get less far apart and end
+	   closer the higher kSync is, up from off
+	   through the values config/main.cpp uses
+	*/
+	std::printf("%6s %14s %14s\n", "kSync", "spread (deg)", "ends (deg)");
+	Spread previous = sync_spread(0);
+	bool passed = true;
+	for(double kSync : { 0.2, 0.5, 1.0 })
+	{
+		Spread spread = sync_spread(kSync);
+		passed = passed && spread.most < previous.most &&
+				 spread.end < previous.end;
+		previous = spread;
+	}
+	return passed;
+}
+
+bool write_script(const char* path, std::vector<const char*> names,
+				  std::vector<script::Instruction> instructions)
+{
+	/*
+	   a compiled script, laid out as
+	   script-format.hpp describes
+	*/
+	std::vector<std::uint8_t> data(script::magic, script::magic + 4);
+	data.push_back(script::version);
+	data.push_back(names.size());
+	data.push_back(instructions.size() & 0xFF);
+	data.push_back(instructions.size() >> 8);
+	for(const char* name : names)
+	{
+		char padded[script::name_length] = {};
+		std::strncpy(padded, name, script::name_length);
+		data.insert(data.end(), padded, padded + script::name_length);
+	}
+	for(const script::Instruction& instruction : instructions)
+	{
+		data.push_back(static_cast<std::uint8_t>(instruction.op));
+		data.push_back(instruction.target);
+		data.push_back(instruction.a & 0xFF);
+		data.push_back(instruction.a >> 8 & 0xFF);
+		data.push_back(instruction.b & 0xFF);
+		data.push_back(instruction.b >> 8 & 0xFF);
+	}
+	std::FILE* file = std::fopen(path, "wb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	std::fwrite(data.data(), 1, data.size(), file);
+	std::fclose(file);
+	return true;
+}
+
+void run_script(void* param)
+{
+	/*
+	   an autonomous that runs the loaded script
+	*/
+	auton_script.run();
+}
+
+bool moving()
+{
+	/*
+	   whether the drive, ramp or scooper is driven.
+	   The arm is left out, driver control takes it
+	   over with arm_control.update() to hold it up
+	*/
+	for(std::uint8_t port : { 1, 2, 3, 4, 12, 13 })
+	{
+		if(sim::motor(port).voltage != 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool script_stop_check()
+{
+	/*
+	   a script stopped while a parallel block has
+	   the workers driving, deploying and moving the
+	   arm, as driver control starts at the end of
+	   autonomous.  stop() must get every worker to
+	   return within its timeout and leave nothing
+	   moving, and the workers must still run the
+	   next script
+	*/
+	using script::Instruction;
+	using script::Op;
+	sim::set_scheduling(true);
+	initialize();
+	// the warm up loads the routine from the sd card
+	warm_up.wait(5000);
+
+	const char* path = "/tmp/sim-check-script.bin";
+	bool written = write_script(path, { "drive", "arm_to", "deploy" },
+								{ Instruction{ Op::parallel, 0, 4, 0 },
+								  Instruction{ Op::move, 0, 3000, 127 },
+								  Instruction{ Op::call, 1, 600, 0 },
+								  Instruction{ Op::call, 2, 8000, 0 },
+								  Instruction{ Op::wait, 0, 5000, 0 } });
+	if(!written || !auton_script.load(path))
+	{
+		std::printf("the script didn't load\n");
+		return false;
+	}
+
+	pros::Task autonomous_task(run_script, nullptr, TASK_PRIORITY_DEFAULT,
+							   TASK_STACK_DEPTH_DEFAULT, "autonomous");
+	pros::delay(400);
+	bool started = moving() && deploy.is_running() &&
+				   sim::motor(5).voltage != 0;
+	autonomous_task.remove();
+
+	std::uint32_t start = pros::millis();
+	auton_script.stop();
+	std::uint32_t took = pros::millis() - start;
+	pros::delay(50);
+	bool still = !moving() && !deploy.is_running();
+	std::printf("stopped 400ms into the block in %ums, %s\n", took,
+				still ? "nothing moving" : "still moving");
+
+	written = write_script(path, { "drive" },
+						   { Instruction{ Op::parallel, 0, 2, 0 },
+							 Instruction{ Op::move, 0, 500, 127 },
+							 Instruction{ Op::wait, 0, 100, 0 } });
+	start = pros::millis();
+	bool again = written && auton_script.load(path) && auton_script.run();
+	std::uint32_t second = pros::millis() - start;
+	std::printf("the next script %s in %ums\n", again ? "ran" : "failed",
+				second);
+	std::remove(path);
+
+	return started && took < AutonScript::stop_timeout && still && again &&
+		   second < 3000;
+}
+
+bool sensors_check()
+{
+	/*
+	   the sensor monitor's waits on the ramp as
+	   config/main.cpp sets it up.  Each wait must
+	   end the sample its condition is met or when
+	   it times out, and a stall wait must end once
+	   the ramp jams, not while it runs.  Then the
+	   script's reach and stall, which must stop a
+	   running ramp at the position and end a stall
+	   wait on a worker as soon as the script is
+	   stopped
+	*/
+	using script::Instruction;
+	using script::Op;
+	sim::set_scheduling(true);
+	initialize();
+	warm_up.wait(5000);
+
+	std::printf("%-24s %6s %10s %10s\n", "wait", "met", "time (ms)",
+				"position");
+	auto timed = [&](const char* name, bool (*wait)(int), int value)
+	{
+		std::uint32_t start = pros::millis();
+		bool met = wait(value);
+		std::uint32_t time = pros::millis() - start;
+		int position = ramp.get_average_position();
+		std::printf("%-24s %6s %10u %10d\n", name, met ? "yes" : "no", time,
+					position);
+		return std::make_pair(met, time);
+	};
+	auto velocity = [](int rpm)
+	{
+		return sensors.wait_until_velocity(&ramp, rpm, 1000);
+	};
+	auto position = [](int ticks)
+	{
+		return sensors.wait_until_position(&ramp, ticks, 3000);
+	};
+	auto never = [](int ms)
+	{
+		return sensors.wait_until_position(&ramp, 30000, ms);
+	};
+	auto stall = [](int ms)
+	{
+		return sensors.wait_until_stall(&ramp, ms);
+	};
+
+	ramp.run(127);
+	auto up_to_speed = timed("up to 150rpm", velocity, 150);
+	int target = ramp.get_average_position() + 1000;
+	auto reached = timed("1000 ticks on", position, target);
+	bool woken = reached.first &&
+				 ramp.get_average_position() - target < 2 * 12;
+	auto timed_out = timed("out of reach in 300ms", never, 300);
+	auto running = timed("stall while running", stall, 300);
+
+	// the ramp jammed, no voltage gets past the friction
+	sim::motor(3).friction = 13000;
+	sim::motor(4).friction = 13000;
+	auto jammed = timed("stall when jammed", stall, 2000);
+	ramp.stop();
+	sim::motor(3).friction = 0;
+	sim::motor(4).friction = 0;
+	pros::delay(200);
+
+	bool waits = up_to_speed.first && woken && !timed_out.first &&
+				 timed_out.second >= 300 && timed_out.second < 320 &&
+				 !running.first && jammed.first &&
+				 jammed.second >= SensorMonitor::stall_time &&
+				 jammed.second < 600;
+
+	// the ramp run up to a position by a script
+	const char* path = "/tmp/sim-check-script.bin";
+	int start = ramp.get_average_position();
+	std::int16_t until = start + 1500;
+	bool written = write_script(path, { "ramp" },
+								{ Instruction{ Op::run, 0, 127, 0 },
+								  Instruction{ Op::reach, 0, until, 3000 },
+								  Instruction{ Op::stop, 0, 0, 0 } });
+	bool ran = written && auton_script.load(path) && auton_script.run();
+	pros::delay(200);
+	int stopped_at = ramp.get_average_position();
+	std::printf("script ran the ramp from %d to %d, %d past %d\n", start,
+				stopped_at, stopped_at - until, until);
+	bool scripted = ran && stopped_at >= until && stopped_at - until < 200;
+
+	// a worker waiting for a stall that never comes, stopped
+	written = write_script(path, { "ramp" },
+						   { Instruction{ Op::run, 0, 60, 0 },
+							 Instruction{ Op::parallel, 0, 2, 0 },
+							 Instruction{ Op::stall, 0, 10000, 0 },
+							 Instruction{ Op::wait, 0, 10000, 0 } });
+	if(!written || !auton_script.load(path))
+	{
+		std::printf("the script didn't load\n");
+		return false;
+	}
+	pros::Task autonomous_task(run_script, nullptr, TASK_PRIORITY_DEFAULT,
+							   TASK_STACK_DEPTH_DEFAULT, "autonomous");
+	pros::delay(300);
+	autonomous_task.remove();
+	std::uint32_t stop_start = pros::millis();
+	auton_script.stop();
+	std::uint32_t took = pros::millis() - stop_start;
+	std::printf("stopped a stall wait in %ums\n", took);
+	std::remove(path);
+
+	return waits && scripted && took < 50 && sim::motor(3).voltage == 0;
+}
+
+bool same(const ControllerSnapshot& a, const ControllerSnapshot& b)
+{
+	/*
+	   whether two ticks of controller input match
+	*/
+	return std::memcmp(a.analog, b.analog, sizeof(a.analog)) == 0 &&
+		   a.digital == b.digital && a.pressed == b.pressed;
+}
+
+struct RoundTrip
+{
+	std::size_t recorded; // ticks
+	std::size_t size; // bytes
+	bool saved;
+	bool full;
+	std::size_t replayed; // ticks matching from the start, in memory
+	std::size_t loaded; // same, from the file
+};
+
+RoundTrip round_trip(std::size_t ticks, void (*set_tick)(std::size_t))
+{
+	/*
+	   records ticks of controller input, set by
+	   set_tick, the way opcontrol() does, then
+	   replays them straight away and from the file
+	*/
+	const char* path = "/tmp/sim-check.rec";
+	static InputRecorder recording(&master);
+	static InputRecorder loading(&master);
+	std::vector<ControllerSnapshot> run;
+
+	// the run starts with the controller let go
+	for(int channel = 0; channel < 4; channel++)
+	{
+		sim::set_analog(static_cast<pros::controller_analog_e_t>(channel), 0);
+	}
+	for(int button = pros::E_CONTROLLER_DIGITAL_L1;
+		button <= pros::E_CONTROLLER_DIGITAL_A; button++)
+	{
+		sim::set_digital(static_cast<pros::controller_digital_e_t>(button),
+						 false);
+	}
+	recording.read();
+
+	recording.start_recording();
+	for(std::size_t tick = 0; tick < ticks; tick++)
+	{
+		set_tick(tick);
+		run.push_back(recording.read());
+	}
+	RoundTrip result = { ticks, recording.get_size(), false, false, 0, 0 };
+	result.saved = recording.stop_recording(path);
+	result.full = recording.is_full();
+
+	auto replay = [&](InputRecorder& recorder, std::size_t& matched)
+	{
+		ControllerSnapshot snapshot;
+		while(matched < run.size() && recorder.next(snapshot) &&
+			  same(snapshot, run[matched]))
+		{
+			matched++;
+		}
+	};
+	replay(recording, result.replayed);
+	if(loading.load(path))
+	{
+		replay(loading, result.loaded);
+	}
+	std::remove(path);
+
+	std::printf("%-9s %6zu %11zu %10.2f %6s %5s %9zu %9zu\n",
+				result.full ? "worst" : "driven", ticks, result.size,
+				result.size / (double)std::max<std::size_t>(result.replayed, 1),
+				result.saved ? "yes" : "no",
+				result.full ? "yes" : "no", result.replayed, result.loaded);
+	return result;
+}
+
+void driven_tick(std::size_t tick)
+{
+	/*
+	   a driver: every so often the sticks head for
+	   new positions, mostly easing there and now and
+	   then snapping, and a button or two is held
+	*/
+	static std::mt19937 random(42);
+	static int stick[4], target[4], slew[4];
+	if(tick % 120 == 0)
+	{
+		for(int channel = 0; channel < 4; channel++)
+		{
+			int position = static_cast<int>(random() % 255) - 127;
+			target[channel] = random() % 3 == 0 ? 0 : position;
+			slew[channel] = random() % 10 == 0 ? 255 : random() % 6 + 1;
+		}
+		sim::set_digital(pros::E_CONTROLLER_DIGITAL_R1, random() % 2);
+		sim::set_digital(pros::E_CONTROLLER_DIGITAL_L1, random() % 4 == 0);
+	}
+	for(int channel = 0; channel < 4; channel++)
+	{
+		int step = target[channel] - stick[channel];
+		int limit = slew[channel];
+		stick[channel] += std::max(-limit, std::min(limit, step));
+		sim::set_analog(static_cast<pros::controller_analog_e_t>(channel),
+						stick[channel]);
+	}
+}
+
+void worst_tick(std::size_t tick)
+{
+	/*
+	   every stick jumps and the buttons change,
+	   every tick
+	*/
+	for(int channel = 0; channel < 4; channel++)
+	{
+		sim::set_analog(static_cast<pros::controller_analog_e_t>(channel),
+						tick % 2 ? 100 - channel : -100 + channel);
+	}
+	sim::set_digital(pros::E_CONTROLLER_DIGITAL_R1, tick % 2);
+}
+
+bool recorder_check()
+{
+	/*
+	   a driven 60s run must be saved whole and
+	   replay tick for tick, from memory and from
+	   the file.  A run of the worst ticks must fill
+	   the buffer after buffer_size / 7 of them, be
+	   reported cut short, and replay exactly up to
+	   there
+	*/
+	std::printf("%-9s %6s %11s %10s %6s %5s %9s %9s\n", "run", "ticks",
+				"size (B)", "B / tick", "saved", "full", "replayed",
+				"from file");
+	std::size_t ticks = 60000 / InputRecorder::tick_interval;
+	RoundTrip driven = round_trip(ticks, driven_tick);
+	RoundTrip worst = round_trip(ticks, worst_tick);
+	std::size_t fits = InputRecorder::buffer_size / 7;
+	std::printf("the worst ticks fill the buffer after %zu ticks, %.1fs\n",
+				worst.replayed,
+				worst.replayed * InputRecorder::tick_interval / 1000.0);
+
+	return driven.saved && !driven.full && driven.replayed == ticks &&
+		   driven.loaded == ticks && !worst.saved && worst.full &&
+		   worst.replayed == fits && worst.loaded == fits;
+}
+
+// the vision sensor's focal length in pixels, as VisionTracker works it out
+const double FOCAL_LENGTH =
+	VISION_FOV_WIDTH / 2.0 /
+	std::tan(VisionTracker::field_of_view / 2 * M_PI / 180);
+
+// what the vision tracker reports after a frame
+struct Sighting
+{
+	bool locked;
+	double bearing;
+	double range;
+};
+
+pros::vision_object_s_t cube(std::uint16_t signature, int x, int width)
+{
+	/*
+	   an object the sensor sees centred x pixels
+	   right of the middle of the image
+	*/
+	pros::vision_object_s_t object = {};
+	object.signature = signature;
+	object.type = pros::E_VISION_OBJECT_NORMAL;
+	object.left_coord = x - width / 2;
+	object.width = width;
+	object.height = width;
+	object.x_middle_coord = x;
+	return object;
+}
+
+double cube_bearing(int x)
+{
+	/*
+	   degrees right of the sensor an object at x
+	   really is
+	*/
+	return std::atan2(x, FOCAL_LENGTH) * 180 / M_PI;
+}
+
+double cube_range(int width, double target_width)
+{
+	/*
+	   inches away an object target_width across
+	   really is when it looks width pixels wide
+	*/
+	return target_width * FOCAL_LENGTH / width;
+}
+
+int cube_x(double bearing)
+{
+	/*
+	   where across the image an object bearing
+	   degrees right of the sensor is seen
+	*/
+	return std::lround(FOCAL_LENGTH * std::tan(bearing * M_PI / 180));
+}
+
+bool vision_check()
+{
+	/*
+	   the vision tracker fed frame by frame through
+	   the sim sensor, with a bigger object of
+	   another signature in every frame.  A cube must
+	   lock after 3 frames, keep its track while it
+	   moves and through 5 missed frames, and give
+	   the true bearing and range once the filter
+	   settles.  A bigger cube mustn't take over
+	   while the first is tracked, only once the
+	   first is dropped on its 6th missed frame.
+	   Then the assist, with the drive turning and
+	   the cube moving across the image the way it
+	   turns, must bring a cube 25 degrees to the
+	   right into the middle
+	*/
+	sim::reset();
+	sim::set_scheduling(true);
+	const double width = 5.5;
+	pros::Vision sensor(8);
+	VisionTracker tracker(&sensor, 1, width);
+
+	// the frames, objects biggest first as the sensor sorts them
+	const pros::vision_object_s_t other = cube(2, -20, 120);
+	auto see = [&](std::vector<pros::vision_object_s_t> objects)
+	{
+		objects.insert(objects.begin(), other);
+		sim::set_vision(objects.data(), objects.size());
+		tracker.update();
+		return Sighting{ tracker.has_target(), tracker.get_bearing(),
+						 tracker.get_range() };
+	};
+	auto print = [&](const char* step, const Sighting& seen, double bearing,
+					 double range)
+	{
+		std::printf("%-28s %6s %8.2f %8.2f %8.2f %8.2f\n", step,
+					seen.locked ? "yes" : "no", seen.bearing, bearing,
+					seen.range, range);
+	};
+	auto near = [](const Sighting& seen, double bearing, double range)
+	{
+		return seen.locked && std::abs(seen.bearing - bearing) < 0.5 &&
+			   std::abs(seen.range - range) < 0.5;
+	};
+	std::printf("%-28s %6s %8s %8s %8s %8s\n", "", "locked", "bearing",
+				"true", "range", "true");
+
+	// a cube seen for 2 frames, then a 3rd
+	see({ cube(1, 60, 40) });
+	Sighting seen = see({ cube(1, 60, 40) });
+	print("seen 2 frames", seen, cube_bearing(60), cube_range(40, width));
+	bool confirmed = !seen.locked;
+	seen = see({ cube(1, 60, 40) });
+	print("seen 3 frames", seen, cube_bearing(60), cube_range(40, width));
+	confirmed = confirmed && seen.locked;
+
+	// moving 30 pixels a frame and closing in, then still
+	int x = 60;
+	int size = 40;
+	for(int i = 0; i < 5; i++)
+	{
+		x -= 30;
+		size += 4;
+		seen = see({ cube(1, x, size) });
+	}
+	bool followed = seen.locked;
+	for(int i = 0; i < 6; i++)
+	{
+		seen = see({ cube(1, x, size) });
+	}
+	double first_bearing = cube_bearing(x);
+	double first_range = cube_range(size, width);
+	print("moved and stopped", seen, first_bearing, first_range);
+	followed = followed && near(seen, first_bearing, first_range);
+
+	// a bigger cube to the right, while the first is still seen
+	const pros::vision_object_s_t bigger = cube(1, 100, 80);
+	for(int i = 0; i < 4; i++)
+	{
+		seen = see({ bigger, cube(1, x, size) });
+	}
+	print("bigger cube appears", seen, first_bearing, first_range);
+	bool kept = near(seen, first_bearing, first_range);
+
+	// the first cube missed for 5 frames, then a 6th
+	for(int i = 0; i < VisionTracker::drop_frames; i++)
+	{
+		seen = see({ bigger });
+	}
+	print("first cube missed 5 frames", seen, first_bearing, first_range);
+	kept = kept && near(seen, first_bearing, first_range);
+	for(int i = 0; i < 6; i++)
+	{
+		seen = see({ bigger });
+	}
+	double second_bearing = cube_bearing(bigger.x_middle_coord);
+	double second_range = cube_range(bigger.width, width);
+	print("missed 6 frames and on", seen, second_bearing, second_range);
+	bool switched = near(seen, second_bearing, second_range);
+
+	// every cube gone
+	for(int i = 0; i <= VisionTracker::drop_frames; i++)
+	{
+		seen = see({});
+	}
+	print("all cubes gone 6 frames", seen, 0, 0);
+	bool lost = !seen.locked && seen.bearing == 0 && seen.range == 0;
+
+	// the assist turning the drive onto a cube 25 degrees right
+	pros::Motor left(1, false), right(2, true);
+	MotorGroup drive({ &left, &right }, {});
+	sim::motor(1).friction = FRICTION;
+	sim::motor(2).friction = FRICTION;
+	sim::set_drive(1, 2, 10, 4, 12.5);
+	const double cube_heading = -25;
+	auto bearing_now = [&]() {
+		return sim::drive().heading * 180 / M_PI - cube_heading;
+	};
+	double start_bearing = bearing_now();
+	double half_second_bearing = 0;
+	std::uint32_t now = pros::millis();
+	for(int i = 0; i < 100; i++)
+	{
+		see({ cube(1, cube_x(bearing_now()), 40) });
+		if(tracker.has_target())
+		{
+			tracker.assist(&drive, 0);
+		}
+		pros::Task::delay_until(&now, VisionTracker::update_interval);
+		if(i == 24)
+		{
+			half_second_bearing = bearing_now();
+		}
+	}
+	drive.stop();
+	double end_bearing = bearing_now();
+	std::printf("assist from %.1f deg right of the cube to %.1f deg after "
+				"0.5s and %.1f deg after 2s\n",
+				start_bearing, half_second_bearing, end_bearing);
+	bool assisted = half_second_bearing < start_bearing / 2 &&
+					std::abs(end_bearing) < 3;
+
+	return confirmed && followed && kept && switched && lost && assisted;
+}
+
+bool latency_tasks = false;
+
+bool latency_run()
+{
+	/*
+	   30s of driving through drive_tick() the way
+	   opcontrol() does, with the subsystems on
+	   their tasks or not as latency_tasks says, and
+	   the latency each saw
+	*/
+	sim::set_scheduling(true);
+	initialize();
+	warm_up.wait(5000);
+	subsystem_tasks = latency_tasks;
+	start_subsystems();
+
+	std::uint32_t now = pros::millis();
+	for(std::size_t tick = 0; tick < 3000; tick++)
+	{
+		driven_tick(tick);
+		// a deploy now and then, so it shares the ramp and scooper
+		sim::set_digital(pros::E_CONTROLLER_DIGITAL_A, tick % 1000 == 500);
+		drive_tick(recorder.read());
+		pros::Task::delay_until(&now, InputRecorder::tick_interval);
+	}
+
+	std::printf("%-8s", latency_tasks ? "tasks" : "serial");
+	bool handled = true;
+	for(Subsystem* subsystem : { &drive_subsystem, &ramp_subsystem,
+								 &scooper_subsystem, &arm_subsystem })
+	{
+		std::printf(" %6.3f %6.3f", subsystem->get_average_latency(),
+					subsystem->get_max_latency());
+		handled = handled && subsystem->get_average_latency() > 0;
+	}
+	std::printf("\n");
+	return handled;
+}
+
+bool in_child(bool (*run)());
+
+bool latency_check()
+{
+	/*
+	   the latency from reading the controller to
+	   each subsystem's handler finishing, in ms,
+	   with the handlers run one after another in
+	   the control loop and on their own tasks.  The
+	   sim's microsecond timer adds the host's time
+	   running the handlers, so the numbers compare
+	   the two, they are not the brain's
+	*/
+	std::printf("%-8s", "");
+	for(const char* name : { "drive", "ramp", "scooper", "arm" })
+	{
+		std::printf(" %13s", name);
+	}
+	std::printf("\n%-8s", "");
+	for(int i = 0; i < 4; i++)
+	{
+		std::printf(" %6s %6s", "avg", "max");
+	}
+	std::printf("\n");
+	std::fflush(stdout);
+
+	latency_tasks = false;
+	bool serial = in_child(latency_run);
+	latency_tasks = true;
+	bool tasks = in_child(latency_run);
+	return serial && tasks;
+}
+
+const Check checks[] = {
+	{ "battery", battery_check },
+	{ "speed-map", speed_map_check },
+	{ "deploy", deploy_check },
+	{ "arm", arm_check },
+	{ "sync", sync_check },
+	{ "script-stop", script_stop_check },
+	{ "sensors", sensors_check },
+	{ "recorder", recorder_check },
+	{ "vision", vision_check },
+	{ "latency", latency_check },
+};
+
+bool selected(const char* name, int argc, char** argv)
+{
+	/*
+	   whether a check was asked for, all of them
+	   when none are named
+	*/
+	for(int i = 1; i < argc; i++)
+	{
+		if(std::strcmp(argv[i], name) == 0)
+		{
+			return true;
+		}
+	}
+	return argc == 1;
+}
+bool in_child(bool (*run)())
+{
+	/*
+	   runs in a process forked from this one, so it
+	   leaves nothing behind, and returns whether it
+	   passed
+	*/
+	std::fflush(stdout);
+	pid_t pid = fork();
+	if(pid < 0)
+	{
+		std::perror("fork");
+		std::exit(1);
+	}
+	if(pid == 0)
+	{
+		bool passed = run();
+		std::fflush(stdout);
+		std::_Exit(passed ? 0 : 1);
+	}
+	int status = 0;
+	waitpid(pid, &status, 0);
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	int failed = 0, ran = 0;
+	for(const Check& check : checks)
+	{
+		if(!selected(check.name, argc, argv))
+		{
+			continue;
+		}
+		std::printf("== %s\n", check.name);
+		std::fflush(stdout);
+		bool passed = in_child(check.run);
+		std::printf("%s\n\n", passed ? "ok" : "FAILED");
+		failed += !passed;
+		ran++;
+	}
+	if(ran == 0)
+	{
+		std::fprintf(stderr, "usage: %s [check...]\n", argv[0]);
+		return 1;
+	}
+	std::printf("%d of %d checks failed\n", failed, ran);
+	return failed > 0 ? 1 : 0;
+}
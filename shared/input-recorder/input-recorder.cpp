@@ -0,0 +1,447 @@
+#include "main.h"
+
+#include "input-recorder.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+constexpr char magic[4] = { 'C', 'R', 'E', 'C' };
+constexpr std::uint8_t version = 1;
+constexpr std::size_t header_size = 8;
+
+constexpr std::uint8_t change_tag = 0x80;
+constexpr std::uint8_t small_deltas = 0x20;
+constexpr std::uint8_t buttons_changed = 0x10;
+constexpr std::uint8_t analog_changed = 0x0f;
+constexpr std::size_t max_repeats = 128;
+// tag, 4 analog bytes and 2 button bytes
+constexpr std::size_t max_record_size = 7;
+} // namespace
+
+std::int32_t
+ControllerSnapshot::get_analog(pros::controller_analog_e_t channel) const
+{
+	/*
+	   Returns the stick position between -127 and
+	   127, like pros::Controller::get_analog.
+	*/
+
+	return analog[channel];
+}
+
+bool ControllerSnapshot::get_digital(pros::controller_digital_e_t button) const
+{
+	/*
+	   Returns true if the button is held.
+	*/
+
+	return digital >> (button - pros::E_CONTROLLER_DIGITAL_L1) & 1;
+}
+
+bool ControllerSnapshot::get_digital_new_press(
+	pros::controller_digital_e_t button) const
+{
+	/*
+	   Returns true if the button is held and was not
+	   held the tick before.
+	*/
+
+	return pressed >> (button - pros::E_CONTROLLER_DIGITAL_L1) & 1;
+}
+
+InputRecorder::InputRecorder(pros::Controller* controller)
+{
+	/*
+	   Constructor for input recorder.
+
+	   Reads the given controller, nothing is
+	   recorded until start_recording().
+	*/
+
+	this->controller = controller;
+	last = ControllerSnapshot{ {}, 0, 0 };
+}
+
+ControllerSnapshot InputRecorder::read()
+{
+	/*
+	   Reads the controller once, and records the
+	   reading if a recording is running.
+
+	   Call once per tick of the driver control loop.
+	*/
+
+	ControllerSnapshot snapshot;
+	for(int channel = 0; channel < 4; channel++)
+	{
+		snapshot.analog[channel] = controller->get_analog(
+			static_cast<pros::controller_analog_e_t>(channel));
+	}
+	snapshot.digital = 0;
+	for(int button = pros::E_CONTROLLER_DIGITAL_L1;
+		button <= pros::E_CONTROLLER_DIGITAL_A; button++)
+	{
+		if(controller->get_digital(
+			   static_cast<pros::controller_digital_e_t>(button)) == 1)
+		{
+			snapshot.digital |= 1 << (button - pros::E_CONTROLLER_DIGITAL_L1);
+		}
+	}
+	snapshot.pressed = snapshot.digital & ~held;
+	held = snapshot.digital;
+
+	if(recording)
+	{
+		record(snapshot);
+	}
+	return snapshot;
+}
+
+void InputRecorder::start_recording()
+{
+	/*
+	   Drops whatever was recorded or loaded and
+	   starts recording from the next read().
+	*/
+
+	size = 0;
+	position = 0;
+	last = ControllerSnapshot{ {}, 0, 0 };
+	repeats = 0;
+	loaded = false;
+	full = false;
+	recording = true;
+}
+
+bool InputRecorder::stop_recording(const char* path)
+{
+	/*
+	   Stops recording and writes the recording to
+	   path, for example "/usd/skills.rec".  It can
+	   be replayed straight away without loading it.
+
+	   Returns false if the file could not be
+	   written, or if the run ran out of buffer.  A
+	   run that did is still written and loaded up to
+	   where the buffer filled, is_full() tells the
+	   two apart.
+	*/
+
+	if(!recording)
+	{
+		return false;
+	}
+	end_run();
+	recording = false;
+	loaded = size > 0;
+	rewind();
+
+	std::FILE* file = std::fopen(path, "wb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	std::uint8_t header[header_size] = {
+		magic[0], magic[1], magic[2], magic[3],
+		version, static_cast<std::uint8_t>(tick_interval),
+		static_cast<std::uint8_t>(size & 0xff),
+		static_cast<std::uint8_t>(size >> 8) };
+	bool written = std::fwrite(header, 1, header_size, file) == header_size &&
+				   std::fwrite(buffer, 1, size, file) == size;
+	return std::fclose(file) == 0 && written && !full;
+}
+
+bool InputRecorder::is_recording()
+{
+	/*
+	   Returns true while a recording is running.
+	*/
+
+	return recording;
+}
+
+bool InputRecorder::is_full()
+{
+	/*
+	   Returns true if the last recording ran out of
+	   buffer before it was stopped.
+	*/
+
+	return full;
+}
+
+bool InputRecorder::load(const char* path)
+{
+	/*
+	   Loads a recording written by stop_recording().
+
+	   Returns false and leaves nothing loaded if the
+	   file is missing or is not a recording, so the
+	   same path can be tried with other loaders.
+	*/
+
+	loaded = false;
+	size = 0;
+	if(recording)
+	{
+		return false;
+	}
+
+	std::FILE* file = std::fopen(path, "rb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	std::uint8_t header[header_size];
+	std::size_t length = 0;
+	if(std::fread(header, 1, header_size, file) == header_size)
+	{
+		length = std::fread(buffer, 1, buffer_size, file);
+	}
+	std::fclose(file);
+
+	if(length == 0 || std::memcmp(header, magic, sizeof(magic)) != 0 ||
+	   header[4] != version || header[5] != tick_interval ||
+	   length != static_cast<std::size_t>(header[6] | header[7] << 8))
+	{
+		return false;
+	}
+
+	size = length;
+	loaded = true;
+	rewind();
+	return true;
+}
+
+bool InputRecorder::is_loaded()
+{
+	/*
+	   Returns true if a recording is ready to replay.
+	*/
+
+	return loaded;
+}
+
+void InputRecorder::rewind()
+{
+	/*
+	   Starts the replay over from the first tick.
+	*/
+
+	position = 0;
+	last = ControllerSnapshot{ {}, 0, 0 };
+	repeats = 0;
+}
+
+bool InputRecorder::next(ControllerSnapshot& snapshot)
+{
+	/*
+	   Gets the next tick of the replay.
+
+	   Returns false at the end of the recording,
+	   or if it is cut short.
+	*/
+
+	if(!loaded)
+	{
+		return false;
+	}
+
+	std::uint16_t before = last.digital;
+	if(repeats > 0)
+	{
+		repeats--;
+	}
+	else
+	{
+		if(position >= size)
+		{
+			return false;
+		}
+		std::uint8_t tag = buffer[position++];
+
+		if((tag & change_tag) == 0)
+		{
+			repeats = tag;
+		}
+		else
+		{
+			int channels = tag & analog_changed;
+			std::size_t changed = 0;
+			for(int channel = 0; channel < 4; channel++)
+			{
+				changed += channels >> channel & 1;
+			}
+			std::size_t needed =
+				tag & small_deltas ? (changed + 1) / 2 : changed;
+			if(tag & buttons_changed)
+			{
+				needed += 2;
+			}
+			if(position + needed > size)
+			{
+				return false;
+			}
+
+			int nibble = 0;
+			for(int channel = 0; channel < 4; channel++)
+			{
+				if((channels >> channel & 1) == 0)
+				{
+					continue;
+				}
+				if(tag & small_deltas)
+				{
+					int delta = buffer[position] >> (nibble * 4) & 0x0f;
+					last.analog[channel] += delta < 8 ? delta : delta - 16;
+					if(nibble++ == 1)
+					{
+						position++;
+						nibble = 0;
+					}
+				}
+				else
+				{
+					last.analog[channel] =
+						static_cast<std::int8_t>(buffer[position++]);
+				}
+			}
+			if(nibble == 1)
+			{
+				position++;
+			}
+			if(tag & buttons_changed)
+			{
+				last.digital = buffer[position] | buffer[position + 1] << 8;
+				position += 2;
+			}
+		}
+	}
+
+	snapshot = last;
+	snapshot.pressed = last.digital & ~before;
+	return true;
+}
+
+std::size_t InputRecorder::get_size()
+{
+	/*
+	   Returns the size of the recording in bytes,
+	   without the file header.
+	*/
+
+	return size;
+}
+
+void InputRecorder::record(const ControllerSnapshot& snapshot)
+{
+	/*
+	   Adds one tick to the recording, as a repeat of
+	   the last tick if nothing changed.
+
+	   Ticks after the buffer is full are dropped.
+	*/
+
+	if(full)
+	{
+		return;
+	}
+
+	int changed = 0;
+	bool small = true;
+	for(int channel = 0; channel < 4; channel++)
+	{
+		int delta = snapshot.analog[channel] - last.analog[channel];
+		if(delta != 0)
+		{
+			changed |= 1 << channel;
+			small = small && delta >= -8 && delta <= 7;
+		}
+	}
+	bool buttons = snapshot.digital != last.digital;
+
+	if(changed == 0 && !buttons && size > 0)
+	{
+		if(++repeats == max_repeats)
+		{
+			end_run();
+		}
+		return;
+	}
+
+	end_run();
+	if(size + max_record_size > buffer_size)
+	{
+		full = true;
+		return;
+	}
+
+	append(change_tag | (small ? small_deltas : 0) |
+		   (buttons ? buttons_changed : 0) | changed);
+	int nibble = 0;
+	std::uint8_t packed = 0;
+	for(int channel = 0; channel < 4; channel++)
+	{
+		if((changed >> channel & 1) == 0)
+		{
+			continue;
+		}
+		if(small)
+		{
+			int delta = snapshot.analog[channel] - last.analog[channel];
+			packed |= (delta & 0x0f) << (nibble * 4);
+			if(nibble++ == 1)
+			{
+				append(packed);
+				packed = 0;
+				nibble = 0;
+			}
+		}
+		else
+		{
+			append(static_cast<std::uint8_t>(snapshot.analog[channel]));
+		}
+	}
+	if(nibble == 1)
+	{
+		append(packed);
+	}
+	if(buttons)
+	{
+		append(snapshot.digital & 0xff);
+		append(snapshot.digital >> 8);
+	}
+
+	last = snapshot;
+}
+
+void InputRecorder::end_run()
+{
+	/*
+	   Writes the ticks repeated since the last
+	   change as one byte.
+	*/
+
+	if(repeats > 0 && append(repeats - 1))
+	{
+		repeats = 0;
+	}
+}
+
+bool InputRecorder::append(std::uint8_t byte)
+{
+	/*
+	   Adds a byte to the recording, returns false if
+	   the buffer is full.
+	*/
+
+	if(size == buffer_size)
+	{
+		full = true;
+		return false;
+	}
+	buffer[size++] = byte;
+	return true;
+}
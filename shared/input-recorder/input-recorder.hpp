@@ -0,0 +1,96 @@
+#ifndef INPUT_RECORDER_HPP
+#define INPUT_RECORDER_HPP
+
+/*
+	The ControllerSnapshot struct holds everything
+	the controller reported in one tick, with the same
+	getters as pros::Controller so driver code can run
+	on live or recorded input alike.
+*/
+
+struct ControllerSnapshot
+{
+	std::int8_t analog[4];
+	// one bit per button from L1 (bit 0) to A (bit 11)
+	std::uint16_t digital;
+	// buttons that were not held the tick before
+	std::uint16_t pressed;
+
+	std::int32_t get_analog(pros::controller_analog_e_t channel) const;
+	bool get_digital(pros::controller_digital_e_t button) const;
+	bool get_digital_new_press(pros::controller_digital_e_t button) const;
+};
+
+/*
+	The InputRecorder class records the controller
+	every tick of a practice run and plays it back
+	tick for tick, so a driven skills run can be
+	replayed as an autonomous routine.
+
+	Only what changed since the last tick is stored,
+	ticks where nothing changed are counted instead of
+	stored, and the recording is held in memory until
+	it stops and is written to the sd card.  A tick
+	takes at most 7 bytes, when every stick jumps and
+	the buttons change, so buffer_size (16 KB) always
+	holds 23s and a driven run, where most ticks only
+	nudge a stick or repeat, holds far longer.  A run
+	that doesn't fit is cut short, see is_full().
+
+	Each record starts with a tag byte:
+	  0nnnnnnn  the last snapshot repeats n + 1 ticks
+	  10smdddd  a change: d marks the analog channels
+	            that changed and m the buttons.  The
+	            analog values follow, as 4 bit deltas
+	            packed two to a byte if s is set or
+	            as whole bytes if not, then the 16 bit
+	            buttons if m is set.
+*/
+
+class InputRecorder
+{
+	public:
+	InputRecorder(pros::Controller* controller);
+
+	// live input
+	ControllerSnapshot read();
+
+	// recording
+	void start_recording();
+	bool stop_recording(const char* path);
+	bool is_recording();
+	bool is_full();
+
+	// replay
+	bool load(const char* path);
+	bool is_loaded();
+	void rewind();
+	bool next(ControllerSnapshot& snapshot);
+
+	std::size_t get_size();
+
+	static constexpr std::size_t buffer_size = 16384;
+	// the opcontrol loop period recordings are made and played at
+	static constexpr std::uint32_t tick_interval = 10;
+
+	private:
+	void record(const ControllerSnapshot& snapshot);
+	void end_run();
+	bool append(std::uint8_t byte);
+
+	pros::Controller* controller;
+	std::uint16_t held = 0;
+
+	std::uint8_t buffer[buffer_size];
+	std::size_t size = 0;
+	std::size_t position = 0;
+	// last recorded or replayed snapshot and its pending repeats
+	ControllerSnapshot last;
+	std::size_t repeats = 0;
+
+	bool recording = false;
+	bool full = false;
+	bool loaded = false;
+};
+
+#endif
@@ -0,0 +1,6 @@
+# The control loops and their math, which the speed build profile compiles with
+# HOT_OPTFLAGS (see common.mk). Included by the Makefile here and by
+# ../host/Makefile, so the host benchmark splits the code the same way.
+HOT_FILES:=motor-group.cpp speed-map.cpp arm-controller.cpp stack-deploy.cpp \
+	sensor-monitor.cpp pose-filter.cpp velocity-estimator.cpp filter-bank.cpp
+HOT_OPTFLAGS:=-O3
@@ -0,0 +1 @@
+../../sdk/include/api.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../auton-script/auton-script.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../controller-output/controller-output.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../input-recorder/input-recorder.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../macros/macros.hpp
\ No newline at end of file
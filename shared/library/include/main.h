@@ -0,0 +1 @@
+../../config/main.h
\ No newline at end of file
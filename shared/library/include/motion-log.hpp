@@ -0,0 +1 @@
+../../motion-log/motion-log.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../motor-groups/motor-group.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../pose-filter/pose-filter.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../auton-script/script-format.hpp
\ No newline at end of file
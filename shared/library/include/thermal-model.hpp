@@ -0,0 +1 @@
+../../thermal-model/thermal-model.hpp
\ No newline at end of file
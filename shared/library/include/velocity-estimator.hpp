@@ -0,0 +1 @@
+../../velocity-estimator/velocity-estimator.hpp
\ No newline at end of file
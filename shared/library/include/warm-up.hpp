@@ -0,0 +1 @@
+../../warm-up/warm-up.hpp
\ No newline at end of file
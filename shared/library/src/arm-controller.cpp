@@ -0,0 +1 @@
+../../arm-controller/arm-controller.cpp
\ No newline at end of file
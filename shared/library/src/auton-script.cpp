@@ -0,0 +1 @@
+../../auton-script/auton-script.cpp
\ No newline at end of file
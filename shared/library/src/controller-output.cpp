@@ -0,0 +1 @@
+../../controller-output/controller-output.cpp
\ No newline at end of file
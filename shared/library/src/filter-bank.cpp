@@ -0,0 +1 @@
+../../filter-bank/filter-bank.cpp
\ No newline at end of file
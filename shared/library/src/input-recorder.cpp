@@ -0,0 +1 @@
+../../input-recorder/input-recorder.cpp
\ No newline at end of file
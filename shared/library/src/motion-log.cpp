@@ -0,0 +1 @@
+../../motion-log/motion-log.cpp
\ No newline at end of file
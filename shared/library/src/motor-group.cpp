@@ -0,0 +1 @@
+../../motor-groups/motor-group.cpp
\ No newline at end of file
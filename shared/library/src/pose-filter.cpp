@@ -0,0 +1 @@
+../../pose-filter/pose-filter.cpp
\ No newline at end of file
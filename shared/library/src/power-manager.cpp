@@ -0,0 +1 @@
+../../power-manager/power-manager.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../sensor-monitor/sensor-monitor.cpp
\ No newline at end of file
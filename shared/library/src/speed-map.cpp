@@ -0,0 +1 @@
+../../speed-map/speed-map.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../stack-deploy/stack-deploy.cpp
\ No newline at end of file
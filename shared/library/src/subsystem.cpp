@@ -0,0 +1 @@
+../../subsystem/subsystem.cpp
\ No newline at end of file
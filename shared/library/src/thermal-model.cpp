@@ -0,0 +1 @@
+../../thermal-model/thermal-model.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../velocity-estimator/velocity-estimator.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../vision-tracker/vision-tracker.cpp
\ No newline at end of file
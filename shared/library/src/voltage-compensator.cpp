@@ -0,0 +1 @@
+../../voltage-compensator/voltage-compensator.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../warm-up/warm-up.cpp
\ No newline at end of file
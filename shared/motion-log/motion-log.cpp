@@ -0,0 +1,589 @@
+#include "main.h"
+
+#include "motion-log.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+constexpr char magic[4] = { 'M', 'L', 'O', 'G' };
+constexpr std::uint8_t version = 1;
+
+// bits of Tick::read, the motors' bits follow
+constexpr std::uint16_t time_read = 1 << 0;
+constexpr std::uint16_t output_scale_read = 1 << 1;
+constexpr std::uint16_t voltage_scale_read = 1 << 2;
+constexpr int position_bits = 3;
+constexpr int raw_position_bits = position_bits + MotionLog::max_motors;
+
+bool put(std::FILE* file, const void* data, std::size_t size)
+{
+	// both the brain and the host are little endian
+	return std::fwrite(data, 1, size, file) == size;
+}
+
+bool get(std::FILE* file, void* data, std::size_t size)
+{
+	return std::fread(data, 1, size, file) == size;
+}
+} // namespace
+
+MotionLog::MotionLog()
+{
+	/*
+	   Constructor for motion log.
+
+	   Nothing is recorded until start_recording().
+	*/
+
+	computed = Tick();
+	replay = MoveReplay();
+}
+
+void MotionLog::start_recording()
+{
+	/*
+	   Drops whatever was recorded or loaded and
+	   records every move from the next one on.
+	*/
+
+	replaying = false;
+	active = false;
+	move_count = 0;
+	tick_count = 0;
+	full = false;
+	recording = true;
+}
+
+bool MotionLog::stop_recording(const char* path)
+{
+	/*
+	   Stops recording and writes the recording to
+	   path, for example "/usd/motion.log".  A move
+	   still running, as when autonomous is ended
+	   partway, is kept up to where it got.
+
+	   Returns false if the file could not be
+	   written.
+	*/
+
+	if(!recording)
+	{
+		return false;
+	}
+	end_move();
+	recording = false;
+
+	std::FILE* file = std::fopen(path, "wb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	std::uint8_t motors = max_motors;
+	std::uint16_t moves_written = move_count;
+	std::uint32_t ticks_written = tick_count;
+	bool written = put(file, magic, sizeof(magic)) &&
+				   put(file, &version, 1) && put(file, &motors, 1) &&
+				   put(file, &moves_written, 2) && put(file, &ticks_written, 4);
+
+	for(std::size_t i = 0; written && i < move_count; i++)
+	{
+		const MotionMove& move = moves[i];
+		std::uint32_t first_tick = move.first_tick;
+		std::uint32_t move_ticks = move.ticks;
+		written = put(file, &move.kind, 1) &&
+				  put(file, &move.position_delta, 4) &&
+				  put(file, &move.max_speed, 4) &&
+				  put(file, &move.error_threshold, 4) &&
+				  put(file, &move.kP, 8) && put(file, &move.kI, 8) &&
+				  put(file, &move.kD, 8) && put(file, &first_tick, 4) &&
+				  put(file, &move_ticks, 4);
+	}
+	for(std::size_t i = 0; written && i < tick_count; i++)
+	{
+		const Tick& tick = ticks[i];
+		written = put(file, &tick.read, 2) && put(file, &tick.written, 2) &&
+				  put(file, &tick.time, 4) &&
+				  put(file, &tick.output_scale, 8) &&
+				  put(file, &tick.voltage_scale, 8) &&
+				  put(file, tick.position, sizeof(tick.position)) &&
+				  put(file, tick.raw_position, sizeof(tick.raw_position)) &&
+				  put(file, tick.raw_timestamp, sizeof(tick.raw_timestamp)) &&
+				  put(file, tick.output, sizeof(tick.output));
+	}
+	return std::fclose(file) == 0 && written;
+}
+
+bool MotionLog::is_recording()
+{
+	/*
+	   Returns true while a recording is running.
+	*/
+
+	return recording;
+}
+
+bool MotionLog::is_full()
+{
+	/*
+	   Returns true if the last recording ran out of
+	   moves or ticks, the moves after that were not
+	   recorded.
+	*/
+
+	return full;
+}
+
+bool MotionLog::load(const char* path)
+{
+	/*
+	   Loads a recording written by stop_recording()
+	   and rewinds it for replay.
+
+	   Returns false and leaves nothing loaded if the
+	   file is missing or is not a motion log.
+	*/
+
+	replaying = false;
+	move_count = 0;
+	tick_count = 0;
+	if(recording)
+	{
+		return false;
+	}
+
+	std::FILE* file = std::fopen(path, "rb");
+	if(file == nullptr)
+	{
+		return false;
+	}
+	char file_magic[4];
+	std::uint8_t file_version = 0;
+	std::uint8_t motors = 0;
+	std::uint16_t moves_read = 0;
+	std::uint32_t ticks_read = 0;
+	bool read = get(file, file_magic, sizeof(file_magic)) &&
+				get(file, &file_version, 1) && get(file, &motors, 1) &&
+				get(file, &moves_read, 2) && get(file, &ticks_read, 4) &&
+				std::memcmp(file_magic, magic, sizeof(magic)) == 0 &&
+				file_version == version && motors == max_motors &&
+				moves_read <= max_moves && ticks_read <= max_ticks;
+
+	for(std::size_t i = 0; read && i < moves_read; i++)
+	{
+		MotionMove& move = moves[i];
+		std::uint32_t first_tick = 0;
+		std::uint32_t move_ticks = 0;
+		read = get(file, &move.kind, 1) && get(file, &move.position_delta, 4) &&
+			   get(file, &move.max_speed, 4) &&
+			   get(file, &move.error_threshold, 4) && get(file, &move.kP, 8) &&
+			   get(file, &move.kI, 8) && get(file, &move.kD, 8) &&
+			   get(file, &first_tick, 4) && get(file, &move_ticks, 4) &&
+			   (move.kind == MoveKind::move || move.kind == MoveKind::turn) &&
+			   move_ticks > 0 && first_tick + move_ticks <= ticks_read;
+		move.first_tick = first_tick;
+		move.ticks = move_ticks;
+	}
+	for(std::size_t i = 0; read && i < ticks_read; i++)
+	{
+		Tick& tick = ticks[i];
+		read = get(file, &tick.read, 2) && get(file, &tick.written, 2) &&
+			   get(file, &tick.time, 4) && get(file, &tick.output_scale, 8) &&
+			   get(file, &tick.voltage_scale, 8) &&
+			   get(file, tick.position, sizeof(tick.position)) &&
+			   get(file, tick.raw_position, sizeof(tick.raw_position)) &&
+			   get(file, tick.raw_timestamp, sizeof(tick.raw_timestamp)) &&
+			   get(file, tick.output, sizeof(tick.output));
+	}
+	std::fclose(file);
+
+	if(!read)
+	{
+		return false;
+	}
+	move_count = moves_read;
+	tick_count = ticks_read;
+	replaying = true;
+	rewind();
+	return true;
+}
+
+void MotionLog::rewind()
+{
+	/*
+	   Starts the replay over from the first move.
+	*/
+
+	next_move_index = 0;
+	active = false;
+}
+
+bool MotionLog::next_move(MotionMove& move)
+{
+	/*
+	   Gets the next recorded move, to be run next
+	   with the same function on a group using this
+	   log.  Its gains can be set to the recorded
+	   ones or to new ones first.
+
+	   Returns false after the last move.
+	*/
+
+	if(!replaying || next_move_index >= move_count)
+	{
+		return false;
+	}
+	move_index = next_move_index++;
+	move = moves[move_index];
+	replay = MoveReplay();
+	return true;
+}
+
+MoveReplay MotionLog::get_replay()
+{
+	/*
+	   Returns how the last replayed move compared
+	   with its recording.
+	*/
+
+	return replay;
+}
+
+void MotionLog::begin_move(MoveKind kind, int position_delta, int max_speed,
+						   int error_threshold, double kP, double kI,
+						   double kD, std::size_t motors)
+{
+	/*
+	   Starts a tick by tick recording of a move, or
+	   the replay of the move next_move() returned.
+
+	   Groups of more than max_motors motors are not
+	   recorded.
+
+	   Only the calling task's reads and writes go
+	   through the log until the move ends.  Other
+	   tasks reading the group, like the sensor
+	   monitor, read the motors as if nothing was
+	   recorded, so they can't change what the move
+	   works from or race it for the tick.
+	*/
+
+	mover = pros::c::task_get_current();
+	if(replaying)
+	{
+		active = true;
+		tick_index = moves[move_index].first_tick;
+		computed = Tick();
+		return;
+	}
+	if(!recording || full || motors > max_motors)
+	{
+		return;
+	}
+	if(move_count == max_moves || tick_count == max_ticks)
+	{
+		full = true;
+		return;
+	}
+
+	moves[move_count] = MotionMove{ kind, position_delta, max_speed,
+									error_threshold, kP, kI, kD,
+									tick_count, 0 };
+	tick_index = tick_count;
+	ticks[tick_index] = Tick();
+	active = true;
+}
+
+bool MotionLog::end_tick()
+{
+	/*
+	   Ends one iteration of the move's loop, just
+	   before it waits.
+
+	   Returns false when a replay gets past where the
+	   recorded loop settled or the recording ends,
+	   the loop must stop there.
+	*/
+
+	if(!active)
+	{
+		return true;
+	}
+
+	if(recording)
+	{
+		moves[move_count].ticks++;
+		tick_count++;
+		if(tick_count == max_ticks)
+		{
+			full = true;
+			move_count++;
+			active = false;
+			return true;
+		}
+		tick_index = tick_count;
+		ticks[tick_index] = Tick();
+		return true;
+	}
+
+	const MotionMove& move = moves[move_index];
+	const Tick& recorded = ticks[tick_index];
+	replay.ticks++;
+	if(recorded.written == 0)
+	{
+		// the recorded loop settled partway through this tick
+		if(replay.end == ReplayEnd::same)
+		{
+			replay.end = ReplayEnd::settled_late;
+		}
+		active = false;
+		return false;
+	}
+
+	compare(recorded);
+	computed = Tick();
+	tick_index++;
+	if(tick_index == move.first_tick + move.ticks)
+	{
+		if(replay.end == ReplayEnd::same)
+		{
+			replay.end = ReplayEnd::settled_late;
+		}
+		active = false;
+		return false;
+	}
+	return true;
+}
+
+void MotionLog::end_move()
+{
+	/*
+	   Ends the move once its loop settled.
+	*/
+
+	if(!active)
+	{
+		return;
+	}
+	active = false;
+
+	if(recording)
+	{
+		// the loop settled partway through a tick, keep what it read
+		if(ticks[tick_index].read != 0)
+		{
+			moves[move_count].ticks++;
+			tick_count++;
+		}
+		if(moves[move_count].ticks > 0)
+		{
+			move_count++;
+		}
+		return;
+	}
+
+	const MotionMove& move = moves[move_index];
+	replay.ticks++;
+	bool settled_here = tick_index + 1 == move.first_tick + move.ticks &&
+						ticks[tick_index].written == 0;
+	if(!settled_here && replay.end == ReplayEnd::same)
+	{
+		replay.end = ReplayEnd::settled_early;
+	}
+}
+
+double MotionLog::read_position(std::size_t index, pros::Motor* motor)
+{
+	/*
+	   Returns the motor's position, as the tick
+	   first read it while a move is recorded or
+	   replayed.
+	*/
+
+	if(!in_move())
+	{
+		return motor->get_position();
+	}
+	if(take(1 << (position_bits + index)))
+	{
+		ticks[tick_index].position[index] = motor->get_position();
+	}
+	return ticks[tick_index].position[index];
+}
+
+std::int32_t MotionLog::read_raw_position(std::size_t index,
+										  pros::Motor* motor,
+										  std::uint32_t* timestamp)
+{
+	/*
+	   Returns the motor's raw count and the time it
+	   was taken, as the tick first read them while
+	   a move is recorded or replayed.
+	*/
+
+	if(!in_move())
+	{
+		return motor->get_raw_position(timestamp);
+	}
+	Tick& tick = ticks[tick_index];
+	if(take(1 << (raw_position_bits + index)))
+	{
+		tick.raw_position[index] =
+			motor->get_raw_position(&tick.raw_timestamp[index]);
+	}
+	*timestamp = tick.raw_timestamp[index];
+	return tick.raw_position[index];
+}
+
+std::uint32_t MotionLog::read_time()
+{
+	/*
+	   Returns pros::millis(), as the tick first read
+	   it while a move is recorded or replayed.
+	*/
+
+	if(!in_move())
+	{
+		return pros::millis();
+	}
+	if(take(time_read))
+	{
+		ticks[tick_index].time = pros::millis();
+	}
+	return ticks[tick_index].time;
+}
+
+double MotionLog::read_output_scale(double scale)
+{
+	/*
+	   Returns the group's output scale, as the tick
+	   first read it while a move is recorded or
+	   replayed.
+	*/
+
+	if(!in_move())
+	{
+		return scale;
+	}
+	if(take(output_scale_read))
+	{
+		ticks[tick_index].output_scale = scale;
+	}
+	return ticks[tick_index].output_scale;
+}
+
+double MotionLog::read_voltage_scale(double scale)
+{
+	/*
+	   Returns the battery's voltage scale, as the
+	   tick first read it while a move is recorded
+	   or replayed.
+	*/
+
+	if(!in_move())
+	{
+		return scale;
+	}
+	if(take(voltage_scale_read))
+	{
+		ticks[tick_index].voltage_scale = scale;
+	}
+	return ticks[tick_index].voltage_scale;
+}
+
+void MotionLog::write_output(std::size_t index, std::int32_t voltage)
+{
+	/*
+	   Keeps the voltage (mV) a motor was sent, to be
+	   recorded or compared with the recording.
+	*/
+
+	if(!in_move())
+	{
+		return;
+	}
+	Tick& tick = recording ? ticks[tick_index] : computed;
+	tick.output[index] = voltage;
+	tick.written |= 1 << index;
+}
+
+std::size_t MotionLog::get_move_count()
+{
+	/*
+	   Returns the number of moves recorded or
+	   loaded.
+	*/
+
+	return move_count;
+}
+
+bool MotionLog::in_move()
+{
+	/*
+	   Returns true if the calling task is the one
+	   running the move being recorded or replayed.
+	*/
+
+	return active && pros::c::task_get_current() == mover;
+}
+
+bool MotionLog::take(std::uint16_t bit)
+{
+	/*
+	   Returns true if a value must be read now, the
+	   first time it is read in a recorded tick.
+
+	   A replayed tick serves what was recorded, a
+	   value that was never recorded there reads as 0
+	   and ends the match with the recording.
+	*/
+
+	Tick& tick = ticks[tick_index];
+	if(tick.read & bit)
+	{
+		return false;
+	}
+	if(recording)
+	{
+		tick.read |= bit;
+		return true;
+	}
+	replay.end = ReplayEnd::missing_value;
+	return false;
+}
+
+void MotionLog::compare(const Tick& recorded)
+{
+	/*
+	   Counts the replayed tick as diverged if it
+	   sent any motor a different voltage, or sent
+	   a different set of motors one.
+	*/
+
+	bool differs = computed.written != recorded.written;
+	std::int32_t largest = 0;
+	for(std::size_t i = 0; i < max_motors; i++)
+	{
+		if(computed.written & recorded.written & 1 << i)
+		{
+			std::int32_t difference =
+				std::abs(computed.output[i] - recorded.output[i]);
+			largest = std::max(largest, difference);
+			differs = differs || difference != 0;
+		}
+	}
+
+	if(differs)
+	{
+		if(replay.diverged == 0)
+		{
+			replay.first_divergence = replay.ticks - 1;
+			replay.first_divergence_time = recorded.time;
+		}
+		replay.diverged++;
+	}
+	replay.max_difference = std::max(replay.max_difference, largest);
+}
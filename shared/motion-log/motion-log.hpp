@@ -0,0 +1,140 @@
+#ifndef MOTION_LOG_HPP
+#define MOTION_LOG_HPP
+
+/*
+	The MotionLog class records what a MotorGroup's
+	PID moves read and commanded, one tick per loop
+	iteration, and replays a recording back through
+	the same moves.
+
+	While a move is recorded, each sensor value the
+	task running it reads is kept the first time it
+	is read in a tick and handed back for the rest
+	of the tick, so the recording holds exactly what
+	the controller worked from.  Reads from other
+	tasks pass straight through.  A replay serves those
+	values instead of reading the motors and checks
+	every output against the recorded one, so a move
+	from the field can be run again on the host, as
+	fast as it computes, with the same or new gains.
+
+	A recording is held in memory and written to the
+	sd card once it stops.
+*/
+
+enum class MoveKind : std::uint8_t
+{
+	move,
+	turn
+};
+
+struct MotionMove
+{
+	MoveKind kind;
+	std::int32_t position_delta;
+	std::int32_t max_speed;
+	std::int32_t error_threshold;
+	// the gains the move ran with
+	double kP, kI, kD;
+	std::size_t first_tick;
+	std::size_t ticks;
+};
+
+// how a replayed move ended against the recording
+enum class ReplayEnd
+{
+	same,
+	settled_early,
+	settled_late,
+	missing_value
+};
+
+struct MoveReplay
+{
+	std::size_t ticks;
+	// ticks whose outputs differ, the first one and the largest difference
+	std::size_t diverged;
+	std::size_t first_divergence;
+	std::uint32_t first_divergence_time;
+	std::int32_t max_difference; // mV
+	ReplayEnd end;
+};
+
+class MotionLog
+{
+	public:
+	MotionLog();
+
+	// recording
+	void start_recording();
+	bool stop_recording(const char* path);
+	bool is_recording();
+	bool is_full();
+
+	// replay
+	bool load(const char* path);
+	void rewind();
+	bool next_move(MotionMove& move);
+	MoveReplay get_replay();
+
+	// called by MotorGroup
+	void begin_move(MoveKind kind, int position_delta, int max_speed,
+					int error_threshold, double kP, double kI, double kD,
+					std::size_t motors);
+	bool end_tick();
+	void end_move();
+	double read_position(std::size_t index, pros::Motor* motor);
+	std::int32_t read_raw_position(std::size_t index, pros::Motor* motor,
+								   std::uint32_t* timestamp);
+	std::uint32_t read_time();
+	double read_output_scale(double scale);
+	double read_voltage_scale(double scale);
+	void write_output(std::size_t index, std::int32_t voltage);
+
+	std::size_t get_move_count();
+
+	static constexpr std::size_t max_motors = 4;
+	static constexpr std::size_t max_moves = 64;
+	// 40s of 10ms ticks
+	static constexpr std::size_t max_ticks = 4000;
+
+	private:
+	struct Tick
+	{
+		// bits of the values below that were read or written
+		std::uint16_t read;
+		std::uint16_t written;
+		std::uint32_t time;
+		double output_scale;
+		double voltage_scale;
+		double position[max_motors];
+		std::int32_t raw_position[max_motors];
+		std::uint32_t raw_timestamp[max_motors];
+		std::int32_t output[max_motors];
+	};
+
+	bool in_move();
+	bool take(std::uint16_t bit);
+	void compare(const Tick& recorded);
+
+	MotionMove moves[max_moves];
+	std::size_t move_count = 0;
+	Tick ticks[max_ticks];
+	std::size_t tick_count = 0;
+
+	bool recording = false;
+	bool full = false;
+	bool replaying = false;
+	// a move is being recorded or replayed, by the task mover
+	std::atomic<bool> active{ false };
+	pros::task_t mover = nullptr;
+
+	// the move being replayed, its tick and what it computed
+	std::size_t next_move_index = 0;
+	std::size_t move_index = 0;
+	std::size_t tick_index = 0;
+	Tick computed;
+	MoveReplay replay;
+};
+
+#endif
@@ -2,6 +2,27 @@
 
 #include "motor-group.hpp"
 
+double MotorGroup::voltage_scale = 1;
+
+namespace
+{
+double degrees_per_count(pros::motor_gearset_e_t gearset)
+{
+	/*
+	   output shaft degrees per raw encoder count
+	*/
+	switch(gearset)
+	{
+		case pros::E_MOTOR_GEARSET_36:
+			return 360.0 / 1800;
+		case pros::E_MOTOR_GEARSET_06:
+			return 360.0 / 300;
+		default:
+			return 360.0 / 900;
+	}
+}
+} // namespace
+
 MotorGroup::MotorGroup(std::vector<pros::Motor*> motors,
 					   std::vector<int> directional_speeds)
 {
@@ -15,6 +36,11 @@ MotorGroup::MotorGroup(std::vector<pros::Motor*> motors,
 
 	this->motors = motors;
 	this->directional_speeds = directional_speeds;
+	raw_offsets.assign(motors.size(), 0);
+	if(directional_speeds.size() == 2)
+	{
+		speed_map.set_speeds(directional_speeds[0], directional_speeds[1]);
+	}
 }
 
 MotorGroup::~MotorGroup()
@@ -43,7 +69,7 @@ void MotorGroup::run(std::vector<int> speed)
 
 	for(int i = 0; i < motors.size(); i++)
 	{
-		motors[i]->move(speed[i]);
+		output(i, speed[i]);
 	}
 }
 
@@ -59,9 +85,15 @@ void MotorGroup::run(int speed)
 	   NOTE: This function ignores all thresholds.
 	*/
 
+	if(kSync != 0)
+	{
+		output_synced(speed);
+		return;
+	}
+
 	for(int i = 0; i < motors.size(); i++)
 	{
-		motors[i]->move(speed);
+		output(i, speed);
 	}
 }
 
@@ -76,30 +108,136 @@ void MotorGroup::run(int button_one, int button_two)
 	   the thresholds set by user.
 	*/
 
-	std::vector<int> voltage = directional_speeds;
-	if(threshold.in_pos(get_average_position()))
+	if(!button_one && !button_two)
 	{
-		voltage = threshold.speed;
-		std::cout << "in threshold" << std::endl;
+		stop();
+		return;
 	}
 
-	if(button_one)
+	int forward = directional_speeds[0];
+	int reverse = directional_speeds[1];
+	speed_map.lookup(get_average_position(), forward, reverse);
+
+	run(button_one ? forward : reverse);
+}
+
+void MotorGroup::sample_velocity(VelocityEstimator& estimator, bool absolute)
+{
+	/*
+	   Hands an estimator the average position in
+	   raw counts, the way get_average_position()
+	   averages it if absolute or else the way
+	   get_signed_position() does, and the time the
+	   first motor sampled it.  Motors report every
+	   10ms, reading more often adds nothing.
+	*/
+
+	std::uint32_t timestamp = 0;
+	double total = 0;
+	for(std::size_t i = 0; i < motors.size(); i++)
 	{
-		for(size_t i = 0; i < motors.size(); i++)
+		std::uint32_t motor_timestamp;
+		std::int32_t count = read_raw_position(i, &motor_timestamp);
+		if(count == PROS_ERR)
 		{
-			motors[i]->move(voltage[0]);
+			return;
 		}
-	}
-	else if(button_two)
-	{
-		for(size_t i = 0; i < motors.size(); i++)
+		if(i == 0)
 		{
-			motors[i]->move(voltage[1]);
+			timestamp = motor_timestamp;
 		}
+		std::int32_t counted = count - raw_offsets[i];
+		total += (absolute ? abs(counted) : counted) *
+				 degrees_per_count(motors[i]->get_gearing());
 	}
-	else
+	estimator.add_sample(total / motors.size(), timestamp);
+}
+
+void MotorGroup::output(std::size_t index, int speed)
+{
+	/*
+	   Sends a speed to a single motor of the group.
+
+	   Every movement function goes through here so
+	   that output scaling (for example from the
+	   thermal model) applies to all of them.
+
+	   The speed (-127 to 127) is converted to mV and
+	   scaled to the voltage the VoltageCompensator
+	   can count on the battery for, so the motor
+	   gets what it is sent at any charge.
+	*/
+
+	double output_scale = this->output_scale;
+	double voltage_scale = MotorGroup::voltage_scale;
+	if(motion_log != nullptr)
 	{
-		stop();
+		output_scale = motion_log->read_output_scale(output_scale);
+		voltage_scale = motion_log->read_voltage_scale(voltage_scale);
+	}
+
+	int voltage = speed * output_scale * voltage_scale * 12000 / 127;
+	if(voltage > 12000)
+	{
+		voltage = 12000;
+	}
+	else if(voltage < -12000)
+	{
+		voltage = -12000;
+	}
+	if(motion_log != nullptr)
+	{
+		motion_log->write_output(index, voltage);
+	}
+	motors[index]->move_voltage(voltage);
+}
+
+void MotorGroup::output_synced(int speed)
+{
+	/*
+	   Sends the same speed to every motor, corrected
+	   to keep the motors at the same position.
+
+	   Motors of a paired mechanism drift apart and
+	   twist it.  Each motor is slowed by kSync for
+	   every degree it is ahead of the group average
+	   (and sped up when behind), so the average
+	   follows the command while the difference is
+	   held at zero.
+	*/
+
+	double mean = 0;
+
+	for(std::size_t i = 0; i < motors.size(); i++)
+	{
+		mean += read_position(i);
+	}
+	mean /= motors.size();
+
+	for(std::size_t i = 0; i < motors.size(); i++)
+	{
+		int correction = kSync * (read_position(i) - mean);
+		output(i, speed - correction);
+	}
+}
+
+void MotorGroup::run_tank(int left_speed, int right_speed)
+{
+	/*
+	   Runs the first half of the motors at one speed
+	   and the second half at another, the way
+	   turn_pid splits a drive train into its left
+	   and right sides.
+
+	   Unlike run(std::vector<int>) it builds no list,
+	   so it can be called from loops that must not
+	   allocate.
+	*/
+
+	std::size_t half = motors.size() / 2;
+	for(std::size_t i = 0; i < motors.size(); i++)
+	{
+		output(i, i < half ? left_speed : right_speed);
 	}
 }
 
@@ -178,8 +316,15 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 	   error_threshold is the accuracy goal within n degrees.
 	*/
 
+	if(motion_log != nullptr)
+	{
+		motion_log->begin_move(MoveKind::move, position_delta, max_speed,
+							   error_threshold, kP, kI, kD, motors.size());
+	}
+
 	// reset values of encoders
 	clear_encoders();
+	pid_cancelled = false;
 
 	// variables used in function
 	const int dT = 10;
@@ -187,7 +332,7 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 	int prev_error = 0;
 	int power;
 	int integral = 0;
-	int derivative;
+	double derivative;
 
 	long long timer = 0;
 
@@ -208,7 +353,7 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 
 		// calculate integral
 		bool passed_setpoint =
-			prev_error > 0 && error < 0 || prev_error < 0 && error > 0;
+			prev_error > 0 && error <= 0 || prev_error < 0 && error >= 0;
 		// limit integral by check in desired range or passed setpoint
 		integral += error;
 
@@ -239,12 +384,12 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 				if(!active)
 				{
 					active = true;
-					timer = pros::millis();
+					timer = read_time();
 				}
 				else
 				{
 					// check if has been stopped in time threshold (ms)
-					if(pros::millis() - timer > 50)
+					if(read_time() - timer > 50)
 					{
 						break;
 					}
@@ -257,8 +402,14 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 			}
 		}
 
-		// calculate derivative
-		derivative = error - prev_error;
+		/*
+		   calculate derivative from the measured velocity,
+		   scaled to a dT step so the constants still fit.
+		   Moving shrinks a positive error and grows a
+		   negative one.
+		*/
+		derivative =
+			(position_delta < 0 ? 1 : -1) * get_velocity() * dT / 1000.0;
 		prev_error = error;
 
 		// execute at power
@@ -273,10 +424,26 @@ void MotorGroup::move_pid(int position_delta, int max_speed,
 		}
 		run(power);
 
+		// a replay stops where the recorded move did
+		if(motion_log != nullptr && !motion_log->end_tick())
+		{
+			break;
+		}
+
+		// another task called cancel_pid()
+		if(pid_cancelled)
+		{
+			break;
+		}
+
 		// wait for poll rate of motors
 		pros::delay(dT);
 	}
 
+	if(motion_log != nullptr)
+	{
+		motion_log->end_move();
+	}
 	stop();
 }
 
@@ -310,6 +477,7 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 
 	// reset values of encoders
 	clear_encoders();
+	pid_cancelled = false;
 
 	// variables used in function
 	const int dT = 10;
@@ -317,19 +485,21 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 	int prev_error = 0;
 	int power;
 	int integral = 0;
-	int derivative;
+	double derivative;
 
 	long long timer = 0;
 
 	bool active = false;
 
+	std::uint32_t last_step = read_time() - dT;
+
 	auto read_index_position = [read_idx, this]() -> int {
 		size_t total = 0;
 		for(size_t i = 0; i < motors.size(); i++)
 		{
 			if(std::find(read_idx.begin(), read_idx.end(), i) != read_idx.end())
 			{
-				total += abs(motors[i]->get_position());
+				total += abs(read_position(i));
 			}
 		}
 		return total;
@@ -350,7 +520,7 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 
 		// calculate integral
 		bool passed_setpoint =
-			prev_error > 0 && error < 0 || prev_error < 0 && error > 0;
+			prev_error > 0 && error <= 0 || prev_error < 0 && error >= 0;
 		// limit integral by check in desired range or passed setpoint
 		integral += error;
 
@@ -381,12 +551,12 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 				if(!active)
 				{
 					active = true;
-					timer = pros::millis();
+					timer = read_time();
 				}
 				else
 				{
 					// check if has been stopped in time threshold (ms)
-					if(pros::millis() - timer > 50)
+					if(read_time() - timer > 50)
 					{
 						break;
 					}
@@ -399,8 +569,11 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 			}
 		}
 
-		// calculate derivative
-		derivative = error - prev_error;
+		// calculate derivative over the time the last step really took
+		std::uint32_t now = read_time();
+		double elapsed = std::max<std::uint32_t>(now - last_step, 1);
+		derivative = (error - prev_error) * dT / elapsed;
+		last_step = now;
 		prev_error = error;
 
 		// execute at power
@@ -420,6 +593,12 @@ void MotorGroup::move_pid_indices(int position_delta, std::vector<double> mod,
 		}
 		run(powers);
 
+		// another task called cancel_pid()
+		if(pid_cancelled)
+		{
+			break;
+		}
+
 		// wait for poll rate of motors
 		pros::delay(dT);
 	}
@@ -442,8 +621,15 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 	   error_threshold is the accuracy goal within n degrees.
 	*/
 
+	if(motion_log != nullptr)
+	{
+		motion_log->begin_move(MoveKind::turn, position_delta, max_speed,
+							   error_threshold, kP2, kI2, kD2, motors.size());
+	}
+
 	// reset values of encoders
 	clear_encoders();
+	pid_cancelled = false;
 
 	// variables used in function
 	const int dT = 10;
@@ -451,7 +637,7 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 	int prev_error = 0;
 	int power;
 	int integral = 0;
-	int derivative;
+	double derivative;
 
 	long long timer = 0;
 
@@ -472,7 +658,7 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 
 		// calculate integral
 		bool passed_setpoint =
-			prev_error > 0 && error < 0 || prev_error < 0 && error > 0;
+			prev_error > 0 && error <= 0 || prev_error < 0 && error >= 0;
 		// limit integral by check in desired range or passed setpoint
 		integral += error;
 
@@ -503,12 +689,12 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 				if(!active)
 				{
 					active = true;
-					timer = pros::millis();
+					timer = read_time();
 				}
 				else
 				{
 					// check if has been stopped in time threshold (ms)
-					if(pros::millis() - timer > 50)
+					if(read_time() - timer > 50)
 					{
 						break;
 					}
@@ -521,8 +707,14 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 			}
 		}
 
-		// calculate derivative
-		derivative = error - prev_error;
+		/*
+		   calculate derivative from the measured velocity,
+		   scaled to a dT step so the constants still fit.
+		   Moving shrinks a positive error and grows a
+		   negative one.
+		*/
+		derivative =
+			(position_delta < 0 ? 1 : -1) * get_velocity() * dT / 1000.0;
 		prev_error = error;
 
 		// execute at power
@@ -546,10 +738,26 @@ void MotorGroup::turn_pid(int position_delta, int max_speed,
 		}
 		run(powers);
 
+		// a replay stops where the recorded move did
+		if(motion_log != nullptr && !motion_log->end_tick())
+		{
+			break;
+		}
+
+		// another task called cancel_pid()
+		if(pid_cancelled)
+		{
+			break;
+		}
+
 		// wait for poll rate of motors
 		pros::delay(dT);
 	}
 
+	if(motion_log != nullptr)
+	{
+		motion_log->end_move();
+	}
 	stop();
 }
 
@@ -564,9 +772,41 @@ void MotorGroup::set_threshold(int start_pos, int end_pos,
 	   Used to control a segment of the position of the
 	   motors' speed. Only used when controlled by via
 	   buttons in the run(int, int) method.
+
+	   Adds a flat zone to the speed map, so several
+	   thresholds can be stacked.  A threshold inside
+	   another, or set after one it overlaps, wins
+	   where they meet, and the speeds either side of
+	   it are the other threshold's.
+	*/
+
+	speed_map.add_zone(start_pos, end_pos, speeds[0], speeds[1]);
+}
+
+void MotorGroup::add_speed_point(int position, std::vector<int> speed)
+{
+	/*
+	   Adds a breakpoint to the speed map, giving the
+	   forward and reverse speeds at a position.
+
+	   Speeds between breakpoints are interpolated, so
+	   a few points give a smooth slow down.  Outside
+	   the first and last point the speeds given to
+	   the constructor are used.  Only used when
+	   controlled via buttons in the run(int, int)
+	   method.
+	*/
+
+	speed_map.add_point(position, speed[0], speed[1]);
+}
+
+void MotorGroup::clear_speed_map()
+{
+	/*
+	   Removes all thresholds and breakpoints.
 	*/
 
-	threshold = PositionalSpeed{ start_pos, end_pos, speeds };
+	speed_map.clear();
 }
 
 void MotorGroup::set_brake(BRAKE_MODE mode)
@@ -599,9 +839,29 @@ unsigned int MotorGroup::get_average_position()
 
 	unsigned int total = 0;
 
-	for(pros::Motor* motor : motors)
+	for(std::size_t i = 0; i < motors.size(); i++)
 	{
-		total += abs(motor->get_position());
+		total += abs(read_position(i));
+	}
+	return total / motors.size();
+}
+
+double MotorGroup::get_signed_position()
+{
+	/*
+	   Returns the mean encoder value of all
+	   motors, keeping its sign.
+
+	   Unlike get_average_position() it goes
+	   negative below 0, so it suits mechanisms that
+	   are held about a position, like an arm.
+	*/
+
+	double total = 0;
+
+	for(std::size_t i = 0; i < motors.size(); i++)
+	{
+		total += read_position(i);
 	}
 	return total / motors.size();
 }
@@ -617,8 +877,295 @@ void MotorGroup::clear_encoders()
 	   point b independent of the start position.
 	*/
 
+	for(std::size_t i = 0; i < motors.size(); i++)
+	{
+		std::uint32_t timestamp;
+		motors[i]->tare_position();
+		raw_offsets[i] = read_raw_position(i, &timestamp);
+	}
+	velocity_estimator.reset();
+	signed_velocity_estimator.reset();
+}
+
+void MotorGroup::set_velocity_filter(VelocityFilter filter, double alpha,
+									 double beta)
+{
+	/*
+	   Smooths get_velocity(), get_signed_velocity()
+	   and get_acceleration(), see
+	   VelocityEstimator::set_filter().
+	*/
+
+	velocity_estimator.set_filter(filter, alpha, beta);
+	signed_velocity_estimator.set_filter(filter, alpha, beta);
+}
+
+double MotorGroup::get_velocity()
+{
+	/*
+	   Returns how fast get_average_position() is
+	   changing, in degrees per second.
+
+	   Unlike pros::Motor::get_actual_velocity it is
+	   worked out from the encoder counts and the
+	   time the motor took them, so it doesn't lag
+	   and a late control loop doesn't skew it.
+	*/
+
+	sample_velocity(velocity_estimator, true);
+	return velocity_estimator.get_velocity();
+}
+
+double MotorGroup::get_signed_velocity()
+{
+	/*
+	   Returns how fast get_signed_position() is
+	   changing, in degrees per second, negative
+	   while it falls.
+	*/
+
+	sample_velocity(signed_velocity_estimator, false);
+	return signed_velocity_estimator.get_velocity();
+}
+
+double MotorGroup::get_acceleration()
+{
+	/*
+	   Returns how fast get_velocity() is changing,
+	   in degrees per second squared.
+	*/
+
+	sample_velocity(velocity_estimator, true);
+	return velocity_estimator.get_acceleration();
+}
+
+std::size_t MotorGroup::size()
+{
+	/*
+	   Returns the number of motors in the
+	   motor group.
+	*/
+
+	return motors.size();
+}
+
+int MotorGroup::get_current_draw()
+{
+	/*
+	   Returns the total current drawn by all
+	   motors in mA.
+
+	   Used to budget current between motor
+	   groups.
+	*/
+
+	int total = 0;
+
+	for(pros::Motor* motor : motors)
+	{
+		int current = motor->get_current_draw();
+		if(current != PROS_ERR)
+		{
+			total += current;
+		}
+	}
+	return total;
+}
+
+double MotorGroup::get_max_temperature()
+{
+	/*
+	   Returns the temperature of the hottest
+	   motor in degrees celsius.
+
+	   The hottest motor is the first one the
+	   firmware will slow down.
+	*/
+
+	double max_temperature = 0;
+
 	for(pros::Motor* motor : motors)
 	{
-		motor->tare_position();
+		double temperature = motor->get_temperature();
+		if(temperature != PROS_ERR_F && temperature > max_temperature)
+		{
+			max_temperature = temperature;
+		}
+	}
+	return max_temperature;
+}
+
+double MotorGroup::get_power()
+{
+	/*
+	   Returns the total power drawn by all
+	   motors in watts.
+	*/
+
+	double total = 0;
+
+	for(pros::Motor* motor : motors)
+	{
+		double power = motor->get_power();
+		if(power != PROS_ERR_F)
+		{
+			total += power;
+		}
+	}
+	return total;
+}
+
+void MotorGroup::set_current_limit(int limit)
+{
+	/*
+	   Sets the current limit of every motor in
+	   the motor group in mA.
+
+	   V5 motors default to 2500mA.
+	*/
+
+	for(pros::Motor* motor : motors)
+	{
+		motor->set_current_limit(limit);
+	}
+}
+
+pros::Motor* MotorGroup::get_motor(std::size_t index)
+{
+	/*
+	   Returns the motor at the given index.
+
+	   Used by services that look at each motor on
+	   its own, like the thermal model.
+	*/
+
+	return motors[index];
+}
+
+void MotorGroup::set_output_scale(double scale)
+{
+	/*
+	   Sets the fraction of every commanded speed
+	   that is sent to the motors (0 to 1).
+
+	   Used to ease off a group before the motor
+	   firmware derates it.
+	*/
+
+	if(scale < 0)
+	{
+		scale = 0;
+	}
+	else if(scale > 1)
+	{
+		scale = 1;
+	}
+	output_scale = scale;
+}
+
+double MotorGroup::get_output_scale()
+{
+	/*
+	   Returns the current output scale.
+	*/
+
+	return output_scale;
+}
+
+void MotorGroup::set_voltage_scale(double scale)
+{
+	/*
+	   Sets the scale applied to the outputs of
+	   every motor group, the voltage a full output
+	   asks for over 12V.
+
+	   Set by the VoltageCompensator.
+	*/
+
+	voltage_scale = scale;
+}
+
+void MotorGroup::set_sync(double kSync)
+{
+	/*
+	   Turns on position synchronisation for commands
+	   that drive every motor at the same speed
+	   (run(int), run(int, int) and move_pid).
+
+	   kSync is the speed taken off a motor per
+	   degree it leads the others.  0 turns it off.
+	   Should only be used on groups whose motors
+	   are mechanically linked, never on a drive.
+	*/
+
+	this->kSync = kSync;
+}
+
+void MotorGroup::cancel_pid()
+{
+	/*
+	   Ends the PID move running on another task at
+	   its next step, which stops the motors and
+	   returns.
+
+	   A move that starts afterwards runs as usual.
+	*/
+
+	pid_cancelled = true;
+}
+
+void MotorGroup::set_log(MotionLog* log)
+{
+	/*
+	   Records move_pid and turn_pid moves to the
+	   log while it records, and runs them from it
+	   while it replays.  nullptr turns it off.
+
+	   move_pid_indices is not recorded.
+	*/
+
+	motion_log = log;
+}
+
+double MotorGroup::read_position(std::size_t index)
+{
+	/*
+	   Reads a motor's position, through the log if
+	   the group has one.
+	*/
+
+	if(motion_log != nullptr)
+	{
+		return motion_log->read_position(index, motors[index]);
+	}
+	return motors[index]->get_position();
+}
+
+std::int32_t MotorGroup::read_raw_position(std::size_t index,
+										   std::uint32_t* timestamp)
+{
+	/*
+	   Reads a motor's raw count and when it was
+	   taken, through the log if the group has one.
+	*/
+
+	if(motion_log != nullptr)
+	{
+		return motion_log->read_raw_position(index, motors[index], timestamp);
+	}
+	return motors[index]->get_raw_position(timestamp);
+}
+
+std::uint32_t MotorGroup::read_time()
+{
+	/*
+	   Reads pros::millis(), through the log if the
+	   group has one.
+	*/
+
+	if(motion_log != nullptr)
+	{
+		return motion_log->read_time();
 	}
+	return pros::millis();
 }
@@ -1,24 +1,6 @@
 #ifndef MOTOR_GROUP_HPP
 #define MOTOR_GROUP_HPP
 
-/*
-	The PositionalSpeed struct allows for a MotorGroup
-	object's speed to be controlled differently within
-	certain ranges of encoder readings.
-*/
-
-struct PositionalSpeed
-{
-	int pos_start;
-	int pos_end;
-	std::vector<int> speed;
-
-	bool in_pos(int pos)
-	{
-		return pos > pos_start && pos < pos_end;
-	}
-};
-
 /*
 	The MotorGroup class maintains a set of multiple
 	pros::Motor objects.  It allows velocity based
@@ -44,6 +26,7 @@ class MotorGroup
 	void run(std::vector<int> speed);
 	void run(int speed);
 	void run(int button_one, int button_two);
+	void run_tank(int left_speed, int right_speed);
 	void stop();
 
 	// PID execution
@@ -56,23 +39,71 @@ class MotorGroup
 						  const int error_threshold = 2);
 	void turn_pid(int position_delta, int max_speed = 127,
 				  const int error_threshold = 2);
+	void cancel_pid();
 
 	// movement speeds
 	void set_threshold(int pos_start, int pos_end, std::vector<int> speed);
+	void add_speed_point(int position, std::vector<int> speed);
+	void clear_speed_map();
 	void set_brake(BRAKE_MODE mode);
 
 	// encoders
 	unsigned int get_average_position();
+	double get_signed_position();
 	void clear_encoders();
 
+	// velocity, from encoder timestamps
+	void set_velocity_filter(VelocityFilter filter, double alpha = 0.5,
+							 double beta = 0.5);
+	double get_velocity();
+	double get_signed_velocity();
+	double get_acceleration();
+
+	// power
+	std::size_t size();
+	int get_current_draw();
+	double get_max_temperature();
+	double get_power();
+	void set_current_limit(int limit);
+	pros::Motor* get_motor(std::size_t index);
+	void set_output_scale(double scale);
+	double get_output_scale();
+	static void set_voltage_scale(double scale);
+
+	// synchronisation
+	void set_sync(double kSync);
+
+	// recording and replay of the PID moves
+	void set_log(MotionLog* log);
+
 	private:
+	void output(std::size_t index, int speed);
+	void output_synced(int speed);
+	void sample_velocity(VelocityEstimator& estimator, bool absolute);
+	double read_position(std::size_t index);
+	std::int32_t read_raw_position(std::size_t index, std::uint32_t* timestamp);
+	std::uint32_t read_time();
+
 	std::vector<pros::Motor*> motors;
 	std::vector<int> directional_speeds;
-	PositionalSpeed threshold = { 0 };
+	SpeedMap speed_map;
+	double output_scale = 1;
+	double kSync = 0;
+	static double voltage_scale;
+
+	// raw encoder counts when the encoders were last cleared
+	std::vector<std::int32_t> raw_offsets;
+	VelocityEstimator velocity_estimator;
+	VelocityEstimator signed_velocity_estimator;
 
 	// PID constants
 	double kP, kI, kD;
 	double kP2, kI2, kD2;
+
+	MotionLog* motion_log = nullptr;
+
+	// set by cancel_pid() to end a PID move running on another task
+	std::atomic<bool> pid_cancelled{ false };
 };
 
 #endif
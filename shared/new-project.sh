@@ -1,9 +1,12 @@
 #!/bin/bash
 
+# the pros kernel, okapi, firmware and common.mk live once in sdk/,
+# projects only hold symlinks to it, so this copies a small skeleton
 if [ -z $1 ]
 then
 	echo "You must supply project name"
 else
-	cp -rf projects/post-state-code projects/$1 
+	cp -rf projects/post-state-code projects/$1
+	rm -rf projects/$1/bin
 	sed -i "s/post-state-code/$1/" -- "projects/$1/project.pros"
 fi
@@ -0,0 +1,368 @@
+#include "main.h"
+
+#include "pose-filter.hpp"
+
+#include <cmath>
+
+namespace
+{
+double counts_per_turn(pros::motor_gearset_e_t gearset)
+{
+	/*
+	   encoder counts per turn of the output shaft
+	*/
+	switch(gearset)
+	{
+		case pros::E_MOTOR_GEARSET_36:
+			return 1800;
+		case pros::E_MOTOR_GEARSET_06:
+			return 300;
+		default:
+			return 900;
+	}
+}
+} // namespace
+
+PoseFilter::PoseFilter(pros::Motor* left, pros::Motor* right, pros::Imu* imu,
+					   double wheel_diameter, double track_width,
+					   double gear_ratio)
+{
+	/*
+	   Constructor for pose filter.
+
+	   gear_ratio is motor turns per wheel turn, the
+	   imu can be nullptr to run on the encoders
+	   alone.  Nothing is read until start().
+	*/
+
+	double travel = M_PI * wheel_diameter / gear_ratio;
+	this->left = Encoder{ left, travel, 0, 0, false };
+	this->right = Encoder{ right, travel, 0, 0, false };
+	this->imu = imu;
+	this->track_width = track_width;
+
+	reset(0, 0, 0);
+}
+
+PoseFilter::~PoseFilter()
+{
+	/*
+	   Destructor for pose filter.
+
+	   Stops the filter task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void PoseFilter::start()
+{
+	/*
+	   Starts the task that updates the filter each
+	   update interval, above the default priority
+	   so the encoder samples are evenly spaced.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	left.travel /= counts_per_turn(left.motor->get_gearing());
+	right.travel /= counts_per_turn(right.motor->get_gearing());
+
+	update();
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT + 1,
+						  TASK_STACK_DEPTH_DEFAULT, "pose filter");
+}
+
+void PoseFilter::task_function(void* param)
+{
+	/*
+	   Entry point of the filter task.
+	*/
+
+	PoseFilter* filter = static_cast<PoseFilter*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		filter->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void PoseFilter::update()
+{
+	/*
+	   Reads every sensor once, predicts the state
+	   forward to now and corrects it with whatever
+	   was measured since the last update.
+
+	   An encoder that has not sampled since the last
+	   update and an imu that is still calibrating or
+	   unplugged are left out.
+	*/
+
+	std::uint32_t now = pros::millis();
+	double dt = last_update == 0 ? 0 : (now - last_update) / 1000.0;
+	last_update = now;
+
+	double left_speed = read_speed(left);
+	double right_speed = read_speed(right);
+
+	bool imu_valid = imu != nullptr && !imu->is_calibrating();
+	double acceleration = 0;
+	double gyro_rate = NAN;
+	double rotation = NAN;
+	if(imu_valid)
+	{
+		// the imu turns clockwise positive
+		acceleration = imu->get_accel().x * gravity;
+		gyro_rate = -imu->get_gyro_rate().z * M_PI / 180;
+		rotation = -imu->get_rotation() * M_PI / 180;
+		if(!std::isfinite(acceleration))
+		{
+			acceleration = 0;
+		}
+	}
+
+	mutex.take(TIMEOUT_MAX);
+	predict(dt, acceleration);
+
+	double half_track = track_width / 2;
+	if(std::isfinite(left_speed))
+	{
+		correct({ 0, 0, 0, 1, -half_track }, left_speed, wheel_noise);
+	}
+	if(std::isfinite(right_speed))
+	{
+		correct({ 0, 0, 0, 1, half_track }, right_speed, wheel_noise);
+	}
+	if(std::isfinite(gyro_rate))
+	{
+		correct({ 0, 0, 0, 0, 1 }, gyro_rate, gyro_noise);
+	}
+	if(std::isfinite(rotation))
+	{
+		imu_heading = rotation;
+		correct({ 0, 0, 1, 0, 0 }, rotation + heading_offset, heading_noise);
+	}
+	mutex.give();
+}
+
+void PoseFilter::reset(double x, double y, double heading)
+{
+	/*
+	   Sets the pose, for example where autonomous
+	   starts, and stops the robot in the estimate.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	state[x_index] = x;
+	state[y_index] = y;
+	state[heading_index] = heading;
+	state[velocity_index] = 0;
+	state[turn_rate_index] = 0;
+	heading_offset = heading - imu_heading;
+
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		for(std::size_t j = 0; j < state_size; j++)
+		{
+			covariance[i][j] = 0;
+		}
+	}
+	mutex.give();
+}
+
+double PoseFilter::get_x()
+{
+	/*
+	   Returns the estimated x position in inches.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double value = state[x_index];
+	mutex.give();
+	return value;
+}
+
+double PoseFilter::get_y()
+{
+	/*
+	   Returns the estimated y position in inches.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double value = state[y_index];
+	mutex.give();
+	return value;
+}
+
+double PoseFilter::get_heading()
+{
+	/*
+	   Returns the estimated heading in radians,
+	   counterclockwise and not wrapped.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double value = state[heading_index];
+	mutex.give();
+	return value;
+}
+
+double PoseFilter::get_velocity()
+{
+	/*
+	   Returns the estimated forward velocity in
+	   inches per second.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double value = state[velocity_index];
+	mutex.give();
+	return value;
+}
+
+double PoseFilter::get_turn_rate()
+{
+	/*
+	   Returns the estimated turn rate in radians
+	   per second, counterclockwise.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double value = state[turn_rate_index];
+	mutex.give();
+	return value;
+}
+
+double PoseFilter::read_speed(Encoder& encoder)
+{
+	/*
+	   Returns the speed of one side of the drive in
+	   inches per second, from the counts and the
+	   time the motor sampled them, or NAN if the
+	   motor has not sampled since the last read.
+	*/
+
+	std::uint32_t timestamp;
+	std::int32_t count = encoder.motor->get_raw_position(&timestamp);
+	if(count == PROS_ERR || (encoder.valid && timestamp == encoder.timestamp))
+	{
+		return NAN;
+	}
+
+	double speed = NAN;
+	if(encoder.valid)
+	{
+		speed = (count - encoder.count) * encoder.travel /
+				((timestamp - encoder.timestamp) / 1000.0);
+	}
+	encoder.count = count;
+	encoder.timestamp = timestamp;
+	encoder.valid = true;
+	return speed;
+}
+
+void PoseFilter::predict(double dt, double acceleration)
+{
+	/*
+	   Moves the state dt seconds forward along an
+	   arc and grows the covariance by the motion's
+	   jacobian and the process noise.
+	*/
+
+	double heading = state[heading_index];
+	double velocity = state[velocity_index];
+	double cos_heading = cos(heading);
+	double sin_heading = sin(heading);
+
+	state[x_index] += velocity * cos_heading * dt;
+	state[y_index] += velocity * sin_heading * dt;
+	state[heading_index] += state[turn_rate_index] * dt;
+	state[velocity_index] += acceleration * dt;
+
+	// the jacobian is the identity apart from these entries
+	double jacobian[state_size][state_size] = {
+		{ 1, 0, -velocity * sin_heading * dt, cos_heading * dt, 0 },
+		{ 0, 1, velocity * cos_heading * dt, sin_heading * dt, 0 },
+		{ 0, 0, 1, 0, dt },
+		{ 0, 0, 0, 1, 0 },
+		{ 0, 0, 0, 0, 1 }
+	};
+
+	double product[state_size][state_size];
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		for(std::size_t j = 0; j < state_size; j++)
+		{
+			double sum = 0;
+			for(std::size_t k = 0; k < state_size; k++)
+			{
+				sum += jacobian[i][k] * covariance[k][j];
+			}
+			product[i][j] = sum;
+		}
+	}
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		for(std::size_t j = 0; j < state_size; j++)
+		{
+			double sum = 0;
+			for(std::size_t k = 0; k < state_size; k++)
+			{
+				sum += product[i][k] * jacobian[j][k];
+			}
+			covariance[i][j] = sum;
+		}
+		covariance[i][i] += process_noise[i] * dt;
+	}
+}
+
+void PoseFilter::correct(const double (&h)[state_size], double measured,
+						 double noise)
+{
+	/*
+	   Corrects the state with one measurement that
+	   is the linear combination h of the state.
+
+	   Measurements are applied one at a time, which
+	   needs no matrix inverse since their noise is
+	   independent.
+	*/
+
+	double predicted = 0;
+	double ph[state_size];
+	double innovation_variance = noise;
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		predicted += h[i] * state[i];
+		ph[i] = 0;
+		for(std::size_t j = 0; j < state_size; j++)
+		{
+			ph[i] += covariance[i][j] * h[j];
+		}
+	}
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		innovation_variance += h[i] * ph[i];
+	}
+
+	double innovation = measured - predicted;
+	for(std::size_t i = 0; i < state_size; i++)
+	{
+		double gain = ph[i] / innovation_variance;
+		state[i] += gain * innovation;
+		for(std::size_t j = 0; j < state_size; j++)
+		{
+			covariance[i][j] -= gain * ph[j];
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#ifndef POSE_FILTER_HPP
+#define POSE_FILTER_HPP
+
+/*
+	The PoseFilter class tracks where the robot is
+	on the field by fusing the drive encoders with
+	the inertial sensor in an extended Kalman filter.
+
+	The state is the position (x, y), the heading,
+	the forward velocity and the turn rate.  Each
+	update predicts the state forward with the
+	accelerometer, then corrects it with the speed
+	of each side of the drive, measured between the
+	encoders' own timestamps, and with the gyro rate
+	and heading.  Everything is a fixed size array
+	updated in place, one update costs a few
+	microseconds.
+
+	Distances are in inches, angles in radians and
+	counterclockwise positive, starting at zero.
+	The sensor's x axis is taken to point forward.
+*/
+
+class PoseFilter
+{
+	public:
+	PoseFilter(pros::Motor* left, pros::Motor* right, pros::Imu* imu,
+			   double wheel_diameter, double track_width,
+			   double gear_ratio = 1);
+	~PoseFilter();
+
+	// task control
+	void start();
+	void update();
+
+	// estimate
+	void reset(double x, double y, double heading);
+	double get_x();
+	double get_y();
+	double get_heading();
+	double get_velocity();
+	double get_turn_rate();
+
+	static constexpr std::uint32_t update_interval = 10;
+	static constexpr std::size_t state_size = 5;
+	// inches per second squared in one g
+	static constexpr double gravity = 386.09;
+
+	// process noise per second of x, y, heading, velocity and turn rate
+	static constexpr double process_noise[state_size] = { 0.01, 0.01, 0.0005,
+														  25, 4 };
+	// measurement noise of a wheel speed, the gyro rate and the heading
+	static constexpr double wheel_noise = 4;
+	static constexpr double gyro_noise = 0.0025;
+	static constexpr double heading_noise = 0.0004;
+
+	private:
+	enum Index
+	{
+		x_index,
+		y_index,
+		heading_index,
+		velocity_index,
+		turn_rate_index
+	};
+
+	struct Encoder
+	{
+		pros::Motor* motor;
+		// inches per count, set by start() for the motor's cartridge
+		double travel;
+		std::int32_t count;
+		std::uint32_t timestamp;
+		bool valid;
+	};
+
+	static void task_function(void* param);
+	double read_speed(Encoder& encoder);
+	void predict(double dt, double acceleration);
+	void correct(const double (&h)[state_size], double measured,
+				 double noise);
+
+	Encoder left;
+	Encoder right;
+	pros::Imu* imu;
+	double track_width;
+
+	double state[state_size];
+	double covariance[state_size][state_size];
+	std::uint32_t last_update = 0;
+	// heading the imu reports and what it was when reset() was called
+	double imu_heading = 0;
+	double heading_offset = 0;
+
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+};
+
+#endif
@@ -0,0 +1,244 @@
+#include "main.h"
+
+#include "power-manager.hpp"
+
+#include <algorithm>
+
+PowerManager::PowerManager(int budget)
+{
+	/*
+	   Constructor for power manager.  Takes the
+	   total current in mA that all registered
+	   motor groups may draw together.
+	*/
+
+	this->budget = budget;
+}
+
+PowerManager::~PowerManager()
+{
+	/*
+	   Destructor for power manager.
+
+	   Stops the sampling task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void PowerManager::start()
+{
+	/*
+	   Starts the task that samples the motors and
+	   reallocates current limits every update
+	   interval.
+
+	   Must be called after all groups are added.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT - 1,
+						  TASK_STACK_DEPTH_DEFAULT, "power manager");
+}
+
+void PowerManager::add_group(MotorGroup* group, int priority, int min_limit,
+							 int max_limit)
+{
+	/*
+	   Registers a motor group with the manager.
+
+	   Higher priority groups are served first.
+	   min_limit is the per motor current (mA) a
+	   group always keeps, max_limit the most it is
+	   ever given.
+
+	   Up to max_groups groups can be added, the
+	   rest are ignored.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	if(group_count < max_groups)
+	{
+		groups[group_count++] = BudgetEntry{ group, priority, min_limit,
+											 max_limit, 0, 0, 0, -1 };
+	}
+	mutex.give();
+}
+
+void PowerManager::set_priority(MotorGroup* group, int priority)
+{
+	/*
+	   Changes the priority of a registered group.
+
+	   Takes the manager's lock, so callers in the
+	   control loop should only call it when the
+	   priority changes, for example when a sprint
+	   starts or ends.  Takes effect on the next
+	   update.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		if(groups[i].group == group)
+		{
+			groups[i].priority = priority;
+		}
+	}
+	mutex.give();
+}
+
+void PowerManager::task_function(void* param)
+{
+	/*
+	   Entry point of the sampling task.
+	*/
+
+	PowerManager* manager = static_cast<PowerManager*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		manager->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void PowerManager::update()
+{
+	/*
+	   Samples every group and reallocates the
+	   current budget.
+
+	   Every group first keeps its minimum.  The
+	   rest of the budget is handed out in priority
+	   order, first up to what each group is drawing
+	   plus headroom and then, if anything is left,
+	   up to each group's maximum.  Limits are only
+	   sent to the motors when they change.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+
+	int remaining = budget;
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		BudgetEntry& entry = groups[i];
+		entry.current = entry.group->get_current_draw();
+		entry.temperature = entry.group->get_max_temperature();
+		entry.power = entry.group->get_power();
+
+		remaining -= entry.min_limit * (int)entry.group->size();
+		order[i] = &entry;
+	}
+
+	// groups of equal priority keep the order they were added in
+	std::sort(order, order + group_count,
+			  [](BudgetEntry* a, BudgetEntry* b) {
+				  return a->priority > b->priority ||
+						 a->priority == b->priority && a < b;
+			  });
+
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		int count = order[i]->group->size();
+		grant[i] = order[i]->min_limit * count;
+	}
+
+	// first pass, cover current demand in priority order
+	for(std::size_t i = 0; i < group_count && remaining > 0; i++)
+	{
+		int count = order[i]->group->size();
+		int want = std::min(order[i]->current + headroom * count,
+							order[i]->max_limit * count);
+		int extra = std::min(std::max(want - grant[i], 0), remaining);
+		grant[i] += extra;
+		remaining -= extra;
+	}
+
+	// second pass, hand out anything left up to the maximum
+	for(std::size_t i = 0; i < group_count && remaining > 0; i++)
+	{
+		int count = order[i]->group->size();
+		int extra = std::min(order[i]->max_limit * count - grant[i], remaining);
+		grant[i] += extra;
+		remaining -= extra;
+	}
+
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		BudgetEntry* entry = order[i];
+		int limit = grant[i] / (int)entry->group->size();
+
+		// skip small changes to keep traffic to the motors down
+		if(abs(limit - entry->limit) > 50)
+		{
+			entry->group->set_current_limit(limit);
+			entry->limit = limit;
+		}
+	}
+
+	mutex.give();
+}
+
+int PowerManager::get_total_current()
+{
+	/*
+	   Returns the total current (mA) of all
+	   groups from the latest sample.
+	*/
+
+	int total = 0;
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		total += groups[i].current;
+	}
+	mutex.give();
+	return total;
+}
+
+double PowerManager::get_max_temperature()
+{
+	/*
+	   Returns the temperature of the hottest
+	   motor from the latest sample.
+	*/
+
+	double max_temperature = 0;
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		max_temperature = std::max(max_temperature, groups[i].temperature);
+	}
+	mutex.give();
+	return max_temperature;
+}
+
+double PowerManager::get_total_power()
+{
+	/*
+	   Returns the total power (W) of all groups
+	   from the latest sample.
+	*/
+
+	double total = 0;
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		total += groups[i].power;
+	}
+	mutex.give();
+	return total;
+}
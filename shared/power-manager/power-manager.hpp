@@ -0,0 +1,75 @@
+#ifndef POWER_MANAGER_HPP
+#define POWER_MANAGER_HPP
+
+/*
+	The PowerManager class shares a total current
+	budget between several MotorGroup objects.
+
+	It periodically samples the current, temperature
+	and power of every registered group and hands out
+	current limits by priority: a high priority group
+	gets what it is drawing (plus headroom) first and
+	lower priority groups share what is left.
+
+	Easing hot groups off before the firmware derates
+	them is left to ThermalModel, the temperatures
+	here are only reported.  Nothing is allocated
+	after construction, so updates are cheap to run
+	beside the control loops.
+*/
+
+class PowerManager
+{
+	public:
+	PowerManager(int budget);
+	~PowerManager();
+
+	// task control
+	void start();
+	void update();
+
+	// groups
+	void add_group(MotorGroup* group, int priority, int min_limit = 500,
+				   int max_limit = 2500);
+	void set_priority(MotorGroup* group, int priority);
+
+	// samples
+	int get_total_current();
+	double get_max_temperature();
+	double get_total_power();
+
+	static constexpr std::uint32_t update_interval = 100;
+	static constexpr std::size_t max_groups = 8;
+	// per motor current above the sampled draw a group is allowed
+	static constexpr int headroom = 500;
+
+	private:
+	struct BudgetEntry
+	{
+		MotorGroup* group;
+		int priority;
+		int min_limit;
+		int max_limit;
+
+		// latest samples
+		int current;
+		double temperature;
+		double power;
+
+		// per motor limit last sent to the motors
+		int limit;
+	};
+
+	static void task_function(void* param);
+
+	int budget;
+	BudgetEntry groups[max_groups];
+	std::size_t group_count = 0;
+	// groups by priority and the current (mA) each is granted
+	BudgetEntry* order[max_groups];
+	int grant[max_groups];
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+};
+
+#endif
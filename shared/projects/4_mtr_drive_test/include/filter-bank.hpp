@@ -0,0 +1 @@
+../../../filter-bank/filter-bank.hpp
\ No newline at end of file
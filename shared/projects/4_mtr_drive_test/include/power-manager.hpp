@@ -0,0 +1 @@
+../../../power-manager/power-manager.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../speed-map/speed-map.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../subsystem/subsystem.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../vision-tracker/vision-tracker.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../voltage-compensator/voltage-compensator.hpp
\ No newline at end of file
@@ -1 +0,0 @@
-../../../motor-groups/motor-group.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../sdk/common.mk
\ No newline at end of file
@@ -0,0 +1 @@
+../../../arm-controller/arm-controller.hpp
\ No newline at end of file
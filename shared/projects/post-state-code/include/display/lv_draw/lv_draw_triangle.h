@@ -1,51 +0,0 @@
-/**
- * @file lv_draw_triangle.h
- *
- */
-
-#ifndef LV_DRAW_TRIANGLE_H
-#define LV_DRAW_TRIANGLE_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "lv_draw.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-/*Experimental use for 3D modeling*/
-#define USE_LV_TRIANGLE 1
-
-#if USE_LV_TRIANGLE != 0
-/**
- *
- * @param points pointer to an array with 3 points
- * @param mask the triangle will be drawn only in this mask
- * @param color color of the triangle
- */
-void lv_draw_triangle(const lv_point_t * points, const lv_area_t * mask, lv_color_t color);
-#endif
-
-/**********************
- *      MACROS
- **********************/
-
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-#endif /*LV_DRAW_TRIANGLE_H*/
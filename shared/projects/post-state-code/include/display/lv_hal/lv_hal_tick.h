@@ -1,66 +0,0 @@
-/**
- * @file lv_hal_tick.h
- * Provide access to the system tick with 1 millisecond resolution
- */
-
-#ifndef LV_HAL_TICK_H
-#define LV_HAL_TICK_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#ifdef LV_CONF_INCLUDE_SIMPLE
-#include "lv_conf.h"
-#else
-#include "display/lv_conf.h"
-#endif
-#include <stdint.h>
-#include <stdbool.h>
-
-/*********************
- *      DEFINES
- *********************/
-#ifndef LV_ATTRIBUTE_TICK_INC
-#define LV_ATTRIBUTE_TICK_INC
-#endif
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**
- * You have to call this function periodically
- * @param tick_period the call period of this function in milliseconds
- */
-LV_ATTRIBUTE_TICK_INC void lv_tick_inc(uint32_t tick_period);
-
-/**
- * Get the elapsed milliseconds since start up
- * @return the elapsed milliseconds
- */
-uint32_t lv_tick_get(void);
-
-/**
- * Get the elapsed milliseconds since a previous time stamp
- * @param prev_tick a previous time stamp (return value of systick_get() )
- * @return the elapsed milliseconds since 'prev_tick'
- */
-uint32_t lv_tick_elaps(uint32_t prev_tick);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-#endif  /*LV_HAL_TICK_H*/
@@ -1,22 +0,0 @@
-/*
- * @author Ryan Benasutti, WPI
- *
- * This Source Code Form is subject to the terms of the Mozilla Public
- * License, v. 2.0. If a copy of the MPL was not distributed with this
- * file, You can obtain one at http://mozilla.org/MPL/2.0/.
- */
-#pragma once
-
-#include "okapi/api/device/rotarysensor/rotarySensor.hpp"
-
-namespace okapi {
-class ContinuousRotarySensor : public RotarySensor {
-  public:
-  /**
-   * Reset the sensor to zero.
-   *
-   * @return `1` on success, `PROS_ERR` on fail
-   */
-  virtual std::int32_t reset() = 0;
-};
-} // namespace okapi
@@ -1,47 +0,0 @@
-/*
- * @author Mikhail Semenov
- * @author Benjamin Jurke
- * @author Ryan Benasutti, WPI
- *
- * This code is a modified version of Benjamin Jurke's work in 2015. You can read his blog post
- * here:
- * https://benjaminjurke.com/content/articles/2015/compile-time-numerical-unit-dimension-checking/
- *
- * This Source Code Form is subject to the terms of the Mozilla Public
- * License, v. 2.0. If a copy of the MPL was not distributed with this
- * file, You can obtain one at http://mozilla.org/MPL/2.0/.
- */
-#pragma once
-
-#include "okapi/api/units/QLength.hpp"
-#include "okapi/api/units/QTime.hpp"
-#include "okapi/api/units/RQuantity.hpp"
-
-namespace okapi {
-QUANTITY_TYPE(0, 1, -1, 0, QSpeed)
-
-constexpr QSpeed mps = meter / second;
-constexpr QSpeed miph = mile / hour;
-constexpr QSpeed kmph = kilometer / hour;
-
-inline namespace literals {
-constexpr QSpeed operator"" _mps(long double x) {
-  return static_cast<double>(x) * mps;
-}
-constexpr QSpeed operator"" _miph(long double x) {
-  return static_cast<double>(x) * mile / hour;
-}
-constexpr QSpeed operator"" _kmph(long double x) {
-  return static_cast<double>(x) * kilometer / hour;
-}
-constexpr QSpeed operator"" _mps(unsigned long long int x) {
-  return static_cast<double>(x) * mps;
-}
-constexpr QSpeed operator"" _miph(unsigned long long int x) {
-  return static_cast<double>(x) * mile / hour;
-}
-constexpr QSpeed operator"" _kmph(unsigned long long int x) {
-  return static_cast<double>(x) * kilometer / hour;
-}
-} // namespace literals
-} // namespace okapi
@@ -1,19 +0,0 @@
-#ifndef PATHFINDER_H_DEF
-#define PATHFINDER_H_DEF
-
-#include "okapi/pathfinder/include/pathfinder/mathutil.h"
-#include "okapi/pathfinder/include/pathfinder/structs.h"
-
-#include "okapi/pathfinder/include/pathfinder/fit.h"
-#include "okapi/pathfinder/include/pathfinder/spline.h"
-#include "okapi/pathfinder/include/pathfinder/trajectory.h"
-
-#include "okapi/pathfinder/include/pathfinder/modifiers/tank.h"
-#include "okapi/pathfinder/include/pathfinder/modifiers/swerve.h"
-
-#include "okapi/pathfinder/include/pathfinder/followers/encoder.h"
-#include "okapi/pathfinder/include/pathfinder/followers/distance.h"
-
-#include "okapi/pathfinder/include/pathfinder/io.h"
-
-#endif
\ No newline at end of file
@@ -0,0 +1 @@
+../../../sensor-monitor/sensor-monitor.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../stack-deploy/stack-deploy.hpp
\ No newline at end of file
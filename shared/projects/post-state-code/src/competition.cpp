@@ -15,6 +15,17 @@ void autonomous()
 	   Runs in the competition for 15 seconds.
 	*/
 
+	// normally done while disabled, only waits without a competition switch
+	warm_up.wait(3000);
+	pose.reset(0, 0, 0);
+	drive_log.start_recording();
+
+	// the routine from the sd card, or the built in one below
+	if(auton_script.run() || replay_routine())
+	{
+		return;
+	}
+
 	scooper.run(127);
 	drive.move_pid(2000);
 	drive.move_pid(-1300);
@@ -28,10 +39,6 @@ void autonomous()
 	drive.move_pid(-1000);
 	drive.turn_pid(-1300);
 	drive.move_pid(1000);
-	while(ramp.get_average_position() < 3000)
-	{
-		ramp.run(true, false);
-	}
-	ramp.stop();
+	deploy.run(deploy.get_timeout());
 }
 
@@ -0,0 +1,343 @@
+#include "main.h"
+
+#include "sensor-monitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SensorMonitor::SensorMonitor()
+{
+	/*
+	   Constructor for sensor monitor.
+
+	   Groups are added with add_group() and are
+	   sampled once start() is called.
+	*/
+
+	for(Waiter& waiter : waiters)
+	{
+		waiter.active = false;
+	}
+	velocity_filter.set_median();
+}
+
+SensorMonitor::~SensorMonitor()
+{
+	/*
+	   Destructor for sensor monitor.
+
+	   Stops the sampling task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void SensorMonitor::start()
+{
+	/*
+	   Starts the task that samples every group
+	   each update interval.
+
+	   Runs above the default priority so waiting
+	   tasks are woken right after a sample.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	update();
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT + 1,
+						  TASK_STACK_DEPTH_DEFAULT, "sensor monitor");
+}
+
+void SensorMonitor::add_group(MotorGroup* group)
+{
+	/*
+	   Registers a motor group to be sampled.
+
+	   Up to max_groups groups can be added, the
+	   rest are ignored.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	if(sample_count < max_groups)
+	{
+		samples[sample_count++] = GroupSample{ group, 0, 0, pros::millis() };
+		velocity_filter.reset();
+	}
+	mutex.give();
+}
+
+void SensorMonitor::task_function(void* param)
+{
+	/*
+	   Entry point of the sampling task.
+	*/
+
+	SensorMonitor* monitor = static_cast<SensorMonitor*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		monitor->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void SensorMonitor::update()
+{
+	/*
+	   Samples every group, then wakes every waiting
+	   task whose condition is now met.
+	*/
+
+	std::uint32_t now = pros::millis();
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < sample_count; i++)
+	{
+		GroupSample& sample = samples[i];
+		MotorGroup* group = sample.group;
+
+		sample.position = group->get_average_position();
+
+		double total = 0;
+		for(std::size_t j = 0; j < group->size(); j++)
+		{
+			total += fabs(group->get_motor(j)->get_actual_velocity());
+		}
+		velocity_filter.set_input(i, total / group->size());
+	}
+
+	// one bad reading can't end a velocity wait or hide a stall
+	velocity_filter.update();
+	for(std::size_t i = 0; i < sample_count; i++)
+	{
+		GroupSample& sample = samples[i];
+		sample.velocity = velocity_filter.get_output(i);
+
+		if(sample.velocity > stall_velocity)
+		{
+			sample.last_moving = now;
+		}
+	}
+
+	for(Waiter& waiter : waiters)
+	{
+		if(waiter.active && !waiter.done && satisfied(waiter, now))
+		{
+			waiter.done = true;
+			pros::c::task_notify(waiter.task);
+		}
+	}
+	mutex.give();
+}
+
+SensorMonitor::GroupSample* SensorMonitor::find(MotorGroup* group)
+{
+	/*
+	   Returns the sample of a registered group or
+	   nullptr if the group was never added.
+	*/
+
+	for(std::size_t i = 0; i < sample_count; i++)
+	{
+		if(samples[i].group == group)
+		{
+			return &samples[i];
+		}
+	}
+	return nullptr;
+}
+
+bool SensorMonitor::satisfied(Waiter& waiter, std::uint32_t now)
+{
+	/*
+	   Checks a waiter's condition against the
+	   latest sample of its group.
+
+	   Position and velocity waits finish once the
+	   value reaches the target from the side it
+	   started on.  A stall wait finishes once the
+	   group has been slower than stall_velocity
+	   for stall_time, counted from when the wait
+	   started so a motor spinning up isn't stalled.
+	*/
+
+	GroupSample* sample = waiter.sample;
+
+	switch(waiter.type)
+	{
+		case WaitType::position:
+			return waiter.rising ? sample->position >= waiter.target :
+								   sample->position <= waiter.target;
+		case WaitType::velocity:
+			return waiter.rising ? sample->velocity >= waiter.target :
+								   sample->velocity <= waiter.target;
+		case WaitType::stall:
+		{
+			std::uint32_t since = std::max(sample->last_moving, waiter.start);
+			return now - since >= stall_time;
+		}
+	}
+	return false;
+}
+
+bool SensorMonitor::wait(MotorGroup* group, WaitType type, double target,
+						 std::uint32_t timeout)
+{
+	/*
+	   Blocks the calling task until a condition is
+	   met or the timeout (ms) runs out.
+
+	   The waiter is registered in a free slot and
+	   the task sleeps on its notification, which
+	   the sampling task sends when the condition
+	   is met.  Returns false on timeout, if the
+	   group was never added or if all slots are
+	   in use.
+	*/
+
+	std::uint32_t now = pros::millis();
+	Waiter* waiter = nullptr;
+
+	mutex.take(TIMEOUT_MAX);
+	GroupSample* sample = find(group);
+	if(sample != nullptr)
+	{
+		for(Waiter& slot : waiters)
+		{
+			if(!slot.active)
+			{
+				waiter = &slot;
+				break;
+			}
+		}
+	}
+	if(waiter == nullptr)
+	{
+		mutex.give();
+		return false;
+	}
+
+	double current =
+		type == WaitType::position ? sample->position : sample->velocity;
+	waiter->active = true;
+	waiter->done = false;
+	waiter->sample = sample;
+	waiter->type = type;
+	waiter->target = target;
+	waiter->rising = current < target;
+	waiter->start = now;
+	waiter->task = pros::c::task_get_current();
+
+	// drop any old notification before checking and sleeping
+	pros::c::task_notify_clear(waiter->task);
+	waiter->done = satisfied(*waiter, now);
+	mutex.give();
+
+	if(!waiter->done)
+	{
+		pros::c::task_notify_take(true, timeout);
+	}
+
+	mutex.take(TIMEOUT_MAX);
+	bool done = waiter->done;
+	waiter->active = false;
+	mutex.give();
+	return done;
+}
+
+bool SensorMonitor::wait_until_position(MotorGroup* group, int position,
+										std::uint32_t timeout)
+{
+	/*
+	   Waits until the average position of a group
+	   reaches the given position.
+
+	   Returns false if it didn't within the
+	   timeout (ms).
+	*/
+
+	return wait(group, WaitType::position, position, timeout);
+}
+
+bool SensorMonitor::wait_until_velocity(MotorGroup* group, double velocity,
+										std::uint32_t timeout)
+{
+	/*
+	   Waits until the average speed (rpm) of a
+	   group reaches the given velocity, rising or
+	   falling depending on where it starts.
+
+	   Returns false if it didn't within the
+	   timeout (ms).
+	*/
+
+	return wait(group, WaitType::velocity, velocity, timeout);
+}
+
+bool SensorMonitor::wait_until_stall(MotorGroup* group, std::uint32_t timeout)
+{
+	/*
+	   Waits until a group stops moving, for
+	   example a mechanism driven into a hard stop.
+
+	   Returns false if it kept moving for the
+	   whole timeout (ms).
+	*/
+
+	return wait(group, WaitType::stall, 0, timeout);
+}
+
+void SensorMonitor::cancel_waits()
+{
+	/*
+	   Ends every wait in progress as if it timed
+	   out, for stopping a routine partway.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	for(Waiter& waiter : waiters)
+	{
+		if(waiter.active && !waiter.done)
+		{
+			pros::c::task_notify(waiter.task);
+		}
+	}
+	mutex.give();
+}
+
+int SensorMonitor::get_position(MotorGroup* group)
+{
+	/*
+	   Returns the latest average position of a
+	   group, or 0 if it was never added.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	GroupSample* sample = find(group);
+	int position = sample != nullptr ? sample->position : 0;
+	mutex.give();
+	return position;
+}
+
+double SensorMonitor::get_velocity(MotorGroup* group)
+{
+	/*
+	   Returns the latest average speed (rpm) of a
+	   group, or 0 if it was never added.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	GroupSample* sample = find(group);
+	double velocity = sample != nullptr ? sample->velocity : 0;
+	mutex.give();
+	return velocity;
+}
@@ -0,0 +1,94 @@
+#ifndef SENSOR_MONITOR_HPP
+#define SENSOR_MONITOR_HPP
+
+/*
+	The SensorMonitor class samples registered
+	MotorGroup objects from its own task and lets
+	other tasks sleep until a group reaches a position,
+	a velocity or stalls.
+
+	A waiting task is blocked on a task notification
+	and is woken by the monitor as soon as a sample
+	meets its condition, so it uses no processor time
+	while it waits.  Every wait has a timeout so a
+	jammed mechanism can't hang autonomous.
+*/
+
+class SensorMonitor
+{
+	public:
+	SensorMonitor();
+	~SensorMonitor();
+
+	// task control
+	void start();
+	void update();
+
+	// groups
+	void add_group(MotorGroup* group);
+
+	// latest samples
+	int get_position(MotorGroup* group);
+	double get_velocity(MotorGroup* group);
+
+	// waits, return false on timeout
+	bool wait_until_position(MotorGroup* group, int position,
+							 std::uint32_t timeout);
+	bool wait_until_velocity(MotorGroup* group, double velocity,
+							 std::uint32_t timeout);
+	bool wait_until_stall(MotorGroup* group, std::uint32_t timeout);
+	void cancel_waits();
+
+	static constexpr std::uint32_t update_interval = 10;
+	static constexpr std::size_t max_groups = 8;
+	static constexpr std::size_t max_waiters = 8;
+	// a group slower than this (rpm) for stall_time (ms) is stalled
+	static constexpr double stall_velocity = 5;
+	static constexpr std::uint32_t stall_time = 200;
+
+	private:
+	enum class WaitType
+	{
+		position,
+		velocity,
+		stall
+	};
+
+	struct GroupSample
+	{
+		MotorGroup* group;
+		int position;
+		double velocity;
+		// time the group last moved faster than stall_velocity
+		std::uint32_t last_moving;
+	};
+
+	struct Waiter
+	{
+		bool active;
+		bool done;
+		GroupSample* sample;
+		WaitType type;
+		double target;
+		// true if waiting for the value to rise to the target
+		bool rising;
+		std::uint32_t start;
+		pros::task_t task;
+	};
+
+	static void task_function(void* param);
+	GroupSample* find(MotorGroup* group);
+	bool satisfied(Waiter& waiter, std::uint32_t now);
+	bool wait(MotorGroup* group, WaitType type, double target,
+			  std::uint32_t timeout);
+
+	GroupSample samples[max_groups];
+	std::size_t sample_count = 0;
+	// median of each group's last few velocities
+	FilterBank velocity_filter{ max_groups };
+	Waiter waiters[max_waiters];
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+};
+
+#endif
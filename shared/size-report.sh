@@ -0,0 +1,89 @@
+#!/bin/bash
+
+# Breaks down the size of a linked project and checks it against a stored budget.
+#
+# usage: size-report.sh <check|update> <budget file> <threshold %> <toolchain prefix> <elf>...
+#
+# check  prints the report and fails if any image grew more than <threshold %>
+#        past its budget or has no budget stored
+# update prints the report and stores the current sizes as the new budget
+
+if [ $# -lt 5 ]
+then
+	echo "usage: size-report.sh <check|update> <budget file> <threshold %> <toolchain prefix> <elf>..."
+	exit 2
+fi
+
+mode=$1
+budget=$2
+threshold=$3
+prefix=$4
+shift 4
+
+status=0
+new_budget=""
+
+for elf in "$@"
+do
+	name=$(basename $elf .elf)
+	bin=${elf%.elf}.bin
+	dir=$(dirname $elf)
+
+	echo "==== $name ===="
+	echo "-- sections"
+	${prefix}size -A -d $elf | grep -E "^\.(text|rodata|data|bss)|^Total"
+
+	echo "-- largest symbols (bytes)"
+	${prefix}nm --size-sort --reverse-sort -S -C --radix=d $elf | head -n 25 |
+		awk '{ size=$2+0; $1=""; $2=""; printf "%8d %s\n", size, $0 }'
+
+	# compiled objects of the project and of the shared library
+	if [ "$name" != "cold.package" ]
+	then
+		echo "-- objects (text data bss)"
+		${prefix}size -d $dir/*.o $dir/../../../library/bin/libshared.a 2> /dev/null |
+			awk 'NR > 1 { printf "%8d %6d %6d %s\n", $1, $2, $3, $6 }' | sort -rn
+	fi
+
+	# what gets uploaded is the binary, fall back to the elf sections
+	if [ -f $bin ]
+	then
+		size=$(stat -c %s $bin)
+	else
+		size=$(${prefix}size -d $elf | awk 'NR == 2 { print $1 + $2 }')
+	fi
+	new_budget="$new_budget$name $size"$'\n'
+
+	limit=$(grep "^$name " $budget 2> /dev/null | awk '{ print $2 }')
+	if [ -z "$limit" ]
+	then
+		# an image without a budget must not pass unchecked
+		echo "-- $name: $size bytes, no budget stored"
+		if [ "$mode" = "check" ]
+		then
+			status=1
+		fi
+	else
+		allowed=$((limit + limit * threshold / 100))
+		echo "-- $name: $size bytes, budget $limit bytes ($((size - limit)) bytes change)"
+		if [ $size -gt $allowed ]
+		then
+			echo "-- $name is more than $threshold% over its budget"
+			status=1
+		fi
+	fi
+	echo
+done
+
+if [ "$mode" = "update" ]
+then
+	printf "%s" "$new_budget" > $budget
+	echo "Stored new budget in $budget"
+	exit 0
+fi
+
+if [ $status -ne 0 ]
+then
+	echo "Size budget exceeded or missing, run 'make size-budget' if the growth is intended"
+fi
+exit $status
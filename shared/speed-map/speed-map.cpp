@@ -0,0 +1,247 @@
+#include "main.h"
+
+#include "speed-map.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SpeedMap::SpeedMap()
+{
+	/*
+	   Constructor for speed map.
+
+	   An empty map covers no positions, so the
+	   group's own speeds are used everywhere.
+	*/
+}
+
+void SpeedMap::add_point(int position, int forward, int reverse)
+{
+	/*
+	   Adds a breakpoint and recompiles the map.
+
+	   A breakpoint at a position that already has
+	   one replaces it.  Compiling takes a moment,
+	   so breakpoints should be set up once, for
+	   example in initialize().
+	*/
+
+	for(SpeedPoint& point : points)
+	{
+		if(point.position == position)
+		{
+			point.forward = forward;
+			point.reverse = reverse;
+			compile();
+			return;
+		}
+	}
+
+	points.push_back(SpeedPoint{ position, forward, reverse });
+	std::sort(points.begin(), points.end(),
+			  [](const SpeedPoint& a, const SpeedPoint& b) {
+				  return a.position < b.position;
+			  });
+	compile();
+}
+
+void SpeedMap::add_zone(int start, int end, int forward, int reverse)
+{
+	/*
+	   Adds a flat zone from start to end and
+	   recompiles the map.
+
+	   A zone goes over the breakpoints and over any
+	   zone around it or added before it.
+	*/
+
+	if(end < start)
+	{
+		return;
+	}
+	zones.push_back(SpeedZone{ start, end, forward, reverse });
+	compile();
+}
+
+void SpeedMap::set_speeds(int forward, int reverse)
+{
+	/*
+	   Sets the group's own speeds, used between
+	   zones and breakpoints inside the map.
+	*/
+
+	this->forward = forward;
+	this->reverse = reverse;
+	compile();
+}
+
+void SpeedMap::clear()
+{
+	/*
+	   Removes every breakpoint and zone.
+	*/
+
+	points.clear();
+	zones.clear();
+	compile();
+}
+
+bool SpeedMap::zone_at(int position, SpeedZone& zone)
+{
+	/*
+	   Finds the zone that wins at a position, the
+	   innermost of the zones there and the last
+	   added of those that only overlap.
+
+	   Returns false if no zone covers it.
+	*/
+
+	const SpeedZone* winner = nullptr;
+	for(const SpeedZone& candidate : zones)
+	{
+		if(position < candidate.start || position > candidate.end)
+		{
+			continue;
+		}
+		bool encloses = winner != nullptr &&
+						candidate.start <= winner->start &&
+						candidate.end >= winner->end &&
+						(candidate.start != winner->start ||
+						 candidate.end != winner->end);
+		if(!encloses)
+		{
+			winner = &candidate;
+		}
+	}
+	if(winner == nullptr)
+	{
+		return false;
+	}
+	zone = *winner;
+	return true;
+}
+
+void SpeedMap::compile()
+{
+	/*
+	   Cuts the map into pieces at every breakpoint
+	   and zone edge, so each piece is flat or linear
+	   from end to end, and notes in the table the
+	   first piece of each evenly spaced cell of the
+	   map.
+
+	   There is one more cell than the narrowest
+	   piece fits into the map, so a cell is always
+	   narrower than any piece.
+	*/
+
+	pieces.clear();
+	std::vector<int> edges;
+	for(const SpeedPoint& point : points)
+	{
+		edges.push_back(point.position);
+	}
+	if(!points.empty())
+	{
+		edges.push_back(points.back().position + 1);
+	}
+	for(const SpeedZone& zone : zones)
+	{
+		edges.push_back(zone.start);
+		edges.push_back(zone.end + 1);
+	}
+	if(edges.empty())
+	{
+		return;
+	}
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	std::size_t segment = 0;
+	for(std::size_t i = 0; i + 1 < edges.size(); i++)
+	{
+		Piece piece{ edges[i], edges[i + 1] - 1, (double)forward,
+					 (double)reverse, 0, 0 };
+		SpeedZone zone;
+		if(zone_at(piece.start, zone))
+		{
+			piece.forward = zone.forward;
+			piece.reverse = zone.reverse;
+		}
+		else if(!points.empty() && piece.start >= points.front().position &&
+				piece.start <= points.back().position)
+		{
+			while(segment + 1 < points.size() &&
+				  points[segment + 1].position <= piece.start)
+			{
+				segment++;
+			}
+			const SpeedPoint& a = points[segment];
+			piece.forward = a.forward;
+			piece.reverse = a.reverse;
+			if(segment + 1 < points.size())
+			{
+				const SpeedPoint& b = points[segment + 1];
+				double ticks = b.position - a.position;
+				double offset = piece.start - a.position;
+				piece.forward_slope = (b.forward - a.forward) / ticks;
+				piece.reverse_slope = (b.reverse - a.reverse) / ticks;
+				piece.forward += piece.forward_slope * offset;
+				piece.reverse += piece.reverse_slope * offset;
+			}
+		}
+		pieces.push_back(piece);
+	}
+
+	start = edges.front();
+	end = edges.back() - 1;
+	int length = end - start + 1;
+	int narrowest = length;
+	for(const Piece& piece : pieces)
+	{
+		narrowest = std::min(narrowest, piece.end - piece.start + 1);
+	}
+	int cells = std::min(length / narrowest + 1, max_cells);
+	cells_per_tick = cells / (double)length;
+	first_piece.assign(cells, 0);
+	for(std::size_t i = pieces.size(); i-- > 0;)
+	{
+		int first = (pieces[i].start - start) * cells_per_tick;
+		int last = (pieces[i].end - start) * cells_per_tick;
+		for(int cell = first; cell <= std::min(last, cells - 1); cell++)
+		{
+			first_piece[cell] = i;
+		}
+	}
+}
+
+bool SpeedMap::lookup(int position, int& forward, int& reverse)
+{
+	/*
+	   Looks up the speeds at an encoder position.
+
+	   Returns false (leaving forward and reverse
+	   untouched) if the position is outside the
+	   breakpoints and zones.
+	*/
+
+	if(pieces.empty() || position < start || position > end)
+	{
+		return false;
+	}
+
+	int cell = std::min<int>((position - start) * cells_per_tick,
+							 first_piece.size() - 1);
+	std::size_t i = first_piece[cell];
+	// once at most, unless the table was capped
+	while(pieces[i].end < position)
+	{
+		i++;
+	}
+	const Piece& piece = pieces[i];
+	forward = lround(piece.forward +
+					 piece.forward_slope * (position - piece.start));
+	reverse = lround(piece.reverse +
+					 piece.reverse_slope * (position - piece.start));
+	return true;
+}
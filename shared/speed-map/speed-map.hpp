@@ -0,0 +1,102 @@
+#ifndef SPEED_MAP_HPP
+#define SPEED_MAP_HPP
+
+/*
+	The SpeedPoint struct is one breakpoint of a
+	SpeedMap: the forward and reverse speeds to use
+	at an encoder position.
+*/
+
+struct SpeedPoint
+{
+	int position;
+	int forward;
+	int reverse;
+};
+
+/*
+	The SpeedZone struct is a flat zone of a
+	SpeedMap: the forward and reverse speeds to use
+	from start to end (inclusive).
+*/
+
+struct SpeedZone
+{
+	int start;
+	int end;
+	int forward;
+	int reverse;
+};
+
+/*
+	The SpeedMap class controls a MotorGroup object's
+	speed by encoder position.
+
+	Any number of breakpoints can be added and speeds
+	between them are interpolated linearly.  Flat
+	zones go over the breakpoints, and where zones
+	overlap the one inside the other wins, or else
+	the one added last, so a position just outside
+	a zone gets the speeds of the zone around it.
+	Between zones and breakpoints the group's own
+	speeds are used.
+
+	Whenever the map changes it is compiled into
+	pieces that are flat or linear from end to end,
+	indexed by a table of evenly spaced cells no
+	wider than the narrowest piece.  A cell then
+	holds at most one piece edge, so looking up a
+	speed while driving takes a table read, one
+	compare and a multiply no matter how many
+	breakpoints and zones there are, and no zone is
+	too narrow to be seen.  The table is capped at
+	max_cells cells, a map with pieces narrower than
+	its length over max_cells steps past the extra
+	edges in a cell.
+*/
+
+class SpeedMap
+{
+	public:
+	SpeedMap();
+
+	// breakpoints and zones
+	void set_speeds(int forward, int reverse);
+	void add_point(int position, int forward, int reverse);
+	void add_zone(int start, int end, int forward, int reverse);
+	void clear();
+
+	// lookup
+	bool lookup(int position, int& forward, int& reverse);
+
+	static constexpr int max_cells = 2048;
+
+	private:
+	// positions start to end, speeds going linearly from the ones at start
+	struct Piece
+	{
+		int start;
+		int end;
+		double forward;
+		double reverse;
+		double forward_slope;
+		double reverse_slope;
+	};
+
+	void compile();
+	bool zone_at(int position, SpeedZone& zone);
+
+	std::vector<SpeedPoint> points;
+	std::vector<SpeedZone> zones;
+	int forward = 0;
+	int reverse = 0;
+
+	// compiled pieces covering [start, end], the first piece of each cell
+	std::vector<Piece> pieces;
+	int start = 0;
+	int end = 0;
+	double cells_per_tick = 0;
+	std::vector<std::uint16_t> first_piece;
+};
+
+#endif
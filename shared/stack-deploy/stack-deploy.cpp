@@ -0,0 +1,349 @@
+#include "main.h"
+
+#include "stack-deploy.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+StackDeploy::StackDeploy(MotorGroup* ramp, MotorGroup* scooper)
+{
+	/*
+	   Constructor for stack deploy.  Takes the ramp
+	   that is raised and the scooper that lets the
+	   stack go.
+
+	   Starts with a default profile, which should be
+	   tuned with set_profile().
+	*/
+
+	this->ramp = ramp;
+	this->scooper = scooper;
+	compile();
+}
+
+StackDeploy::~StackDeploy()
+{
+	/*
+	   Destructor for stack deploy.
+
+	   Stops the deploy task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void StackDeploy::set_profile(int end_position, int slow_start, int slow_end,
+							  double fast_velocity, double slow_velocity,
+							  double acceleration)
+{
+	/*
+	   Sets the shape of the velocity profile.
+
+	   The ramp runs at fast_velocity (rpm) up to
+	   slow_start, at slow_velocity through the
+	   stacking range [slow_start, slow_end] and
+	   stops at end_position.  acceleration (rpm per
+	   second) limits how quickly the profile changes
+	   speed between them.
+	*/
+
+	this->end_position = end_position;
+	this->slow_start = slow_start;
+	this->slow_end = slow_end;
+	this->fast_velocity = fast_velocity;
+	this->slow_velocity = slow_velocity;
+	this->acceleration = acceleration;
+	compile();
+}
+
+void StackDeploy::set_gains(double kV, double kP)
+{
+	/*
+	   Sets the velocity controller constants.
+
+	   kV converts a target velocity (rpm) to power,
+	   kP corrects the remaining velocity error.
+	*/
+
+	this->kV = kV;
+	this->kP = kP;
+}
+
+void StackDeploy::set_outtake(int start_position, int end_position, int speed)
+{
+	/*
+	   Runs the scooper at speed while the ramp is
+	   between start_position and end_position.
+
+	   A speed of 0 leaves the scooper alone.
+	*/
+
+	outtake_start = start_position;
+	outtake_end = end_position;
+	outtake_speed = speed;
+}
+
+void StackDeploy::compile()
+{
+	/*
+	   Builds the velocity table over ramp position.
+
+	   Each cell starts at the speed limit of its
+	   range, a cell reaching into the stacking range
+	   counting as part of it, since the ramp is
+	   given a cell's speed from the start of it.  A
+	   backward pass then makes sure every speed can
+	   be slowed down to the next one and
+	   a forward pass that every speed can be reached
+	   from the one before (from rest at position 0),
+	   using v^2 = v0^2 + 2 * a * distance.
+
+	   Positions are in degrees and velocities in
+	   rpm, one rpm being 6 degrees per second.
+	*/
+
+	double step = end_position / (double)(resolution - 1);
+	double accel = acceleration * 6;
+
+	for(int i = 0; i < resolution; i++)
+	{
+		double position = i * step;
+		double limit = fast_velocity;
+		if(position + step > slow_start && position <= slow_end)
+		{
+			limit = slow_velocity;
+		}
+		table[i] = limit * 6;
+	}
+	table[resolution - 1] = 0;
+
+	for(int i = resolution - 2; i >= 0; i--)
+	{
+		double reachable = sqrt(table[i + 1] * table[i + 1] + 2 * accel * step);
+		table[i] = std::min((double)table[i], reachable);
+	}
+
+	double previous = 0;
+	for(int i = 0; i < resolution; i++)
+	{
+		double reachable = sqrt(previous * previous + 2 * accel * step);
+		table[i] = std::min((double)table[i], reachable);
+		previous = table[i];
+	}
+
+	for(int i = 0; i < resolution; i++)
+	{
+		table[i] = std::max(table[i] / 6, (float)min_velocity);
+	}
+}
+
+double StackDeploy::get_target_velocity(int position)
+{
+	/*
+	   Returns the profile velocity (rpm) at a ramp
+	   position.
+	*/
+
+	int cell = position * (resolution - 1) / end_position;
+	cell = std::min(std::max(cell, 0), resolution - 1);
+	return table[cell];
+}
+
+std::uint32_t StackDeploy::get_duration()
+{
+	/*
+	   Returns how long (ms) a deploy takes if the
+	   ramp follows the profile, for its timeout.
+	*/
+
+	double step = end_position / (double)(resolution - 1);
+	double seconds = 0;
+	for(int i = 0; i < resolution - 1; i++)
+	{
+		seconds += step / (table[i] * 6);
+	}
+	return seconds * 1000;
+}
+
+std::uint32_t StackDeploy::get_timeout()
+{
+	/*
+	   Returns a timeout (ms) for run() and trigger()
+	   with room for a ramp that is slowed down, by a
+	   low battery or the power budget, without
+	   timing out mid stack.
+	*/
+
+	return get_duration() * timeout_margin + timeout_slack;
+}
+
+double StackDeploy::get_velocity()
+{
+	/*
+	   Returns the speed (rpm) of the ramp, from the
+	   group's encoder based estimate rather than the
+	   motors' lagging get_actual_velocity.
+	*/
+
+	return ramp->get_velocity() / 6;
+}
+
+bool StackDeploy::run(std::uint32_t timeout)
+{
+	/*
+	   Raises the ramp along the profile, blocking
+	   until it reaches the end position.  The deploy
+	   runs on the deploy task, or on the calling task
+	   if start_task() was never called.  If one is
+	   already running it waits for that one.
+
+	   Returns false if it was cancelled or didn't
+	   get there within the timeout (ms).
+	*/
+
+	if(task == nullptr)
+	{
+		cancelled = false;
+		running = true;
+		return execute(timeout);
+	}
+
+	trigger(timeout);
+	while(running)
+	{
+		pros::delay(dT);
+	}
+	return succeeded;
+}
+
+bool StackDeploy::execute(std::uint32_t timeout)
+{
+	/*
+	   Runs the deploy control loop on the calling
+	   task.  The ramp and scooper are stopped when
+	   it finishes, however it finishes.
+	*/
+
+	std::uint32_t start = pros::millis();
+	std::uint32_t now = start;
+	bool done = false;
+
+	while(!cancelled && now - start < timeout)
+	{
+		int position = ramp->get_average_position();
+		if(position >= end_position)
+		{
+			done = true;
+			break;
+		}
+
+		double target = get_target_velocity(position);
+		double power = kV * target + kP * (target - get_velocity());
+		// negative power brakes the ramp down to the stacking speed
+		power = std::min(std::max(power, -127.0), 127.0);
+		ramp->run((int)power);
+
+		if(outtake_speed != 0)
+		{
+			if(position >= outtake_start && position <= outtake_end)
+			{
+				scooper->run(outtake_speed);
+			}
+			else
+			{
+				scooper->stop();
+			}
+		}
+
+		pros::Task::delay_until(&now, dT);
+	}
+
+	ramp->stop();
+	if(outtake_speed != 0)
+	{
+		scooper->stop();
+	}
+
+	succeeded = done;
+	running = false;
+	return done;
+}
+
+void StackDeploy::start_task()
+{
+	/*
+	   Starts the task that runs triggered deploys.
+
+	   Should be called once from initialize() so no
+	   task has to be created mid match.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT,
+						  TASK_STACK_DEPTH_DEFAULT, "stack deploy");
+}
+
+void StackDeploy::task_function(void* param)
+{
+	/*
+	   Entry point of the deploy task.  Sleeps until
+	   a deploy is triggered.
+	*/
+
+	StackDeploy* deploy = static_cast<StackDeploy*>(param);
+
+	while(true)
+	{
+		pros::c::task_notify_take(true, TIMEOUT_MAX);
+		deploy->execute(deploy->task_timeout);
+	}
+}
+
+void StackDeploy::trigger(std::uint32_t timeout)
+{
+	/*
+	   Starts a deploy on the deploy task and
+	   returns straight away.
+
+	   Ignored if a deploy is already running.
+	*/
+
+	bool idle = false;
+	if(task == nullptr || !running.compare_exchange_strong(idle, true))
+	{
+		return;
+	}
+
+	task_timeout = timeout;
+	cancelled = false;
+	task->notify();
+}
+
+void StackDeploy::cancel()
+{
+	/*
+	   Stops a running deploy at its next step.
+	*/
+
+	cancelled = true;
+}
+
+bool StackDeploy::is_running()
+{
+	/*
+	   Returns whether a deploy is in progress.
+
+	   While it is, nothing else should command the
+	   ramp or the scooper.
+	*/
+
+	return running;
+}
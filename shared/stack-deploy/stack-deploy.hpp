@@ -0,0 +1,93 @@
+#ifndef STACK_DEPLOY_HPP
+#define STACK_DEPLOY_HPP
+
+/*
+	The StackDeploy class raises the ramp to stack in
+	one closed loop motion.
+
+	A velocity profile over ramp position is computed
+	once: the ramp runs fast through the empty part of
+	its travel, decelerates into the stacking range,
+	crawls through it and slows to a stop at the end.
+	While deploying the ramp follows the profile with
+	feedforward plus proportional velocity control and
+	the scooper is run outward over a range of ramp
+	positions to let the stack go.
+
+	Every deploy runs on the deploy task.  trigger()
+	starts one and returns so the driver can keep
+	driving, run() starts one and waits for it (for
+	autonomous).  A caller that is stopped while it
+	waits, as autonomous is at the end of the
+	period, leaves the deploy to finish or time out
+	on its own.
+*/
+
+class StackDeploy
+{
+	public:
+	StackDeploy(MotorGroup* ramp, MotorGroup* scooper);
+	~StackDeploy();
+
+	// configuration
+	void set_profile(int end_position, int slow_start, int slow_end,
+					 double fast_velocity, double slow_velocity,
+					 double acceleration);
+	void set_gains(double kV, double kP);
+	void set_outtake(int start_position, int end_position, int speed);
+
+	// execution
+	void start_task();
+	bool run(std::uint32_t timeout);
+	void trigger(std::uint32_t timeout);
+	void cancel();
+	bool is_running();
+
+	// profile
+	double get_target_velocity(int position);
+	std::uint32_t get_duration();
+	std::uint32_t get_timeout();
+
+	static constexpr int resolution = 128;
+	static constexpr std::uint32_t dT = 10;
+	// lowest profile speed (rpm) so the ramp always reaches the end
+	static constexpr double min_velocity = 10;
+	// timeouts allow the duration times timeout_margin plus timeout_slack ms
+	static constexpr double timeout_margin = 1.5;
+	static constexpr std::uint32_t timeout_slack = 500;
+
+	private:
+	static void task_function(void* param);
+	void compile();
+	double get_velocity();
+	bool execute(std::uint32_t timeout);
+
+	MotorGroup* ramp;
+	MotorGroup* scooper;
+
+	// profile
+	int end_position = 3000;
+	int slow_start = 1500;
+	int slow_end = 2500;
+	double fast_velocity = 150;
+	double slow_velocity = 40;
+	double acceleration = 600;
+	float table[resolution];
+
+	// control
+	double kV = 127.0 / 200.0;
+	double kP = 0.5;
+
+	// scooper outtake
+	int outtake_start = 0;
+	int outtake_end = 0;
+	int outtake_speed = 0;
+
+	pros::Task* task = nullptr;
+	std::atomic<bool> running{ false };
+	std::atomic<bool> cancelled{ false };
+	std::atomic<bool> succeeded{ false };
+	std::uint32_t task_timeout = 0;
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include "main.h"
+
+#include "subsystem.hpp"
+
+// the V5 runtime's microsecond timer, which this PROS has no call for
+extern "C" std::uint64_t vexSystemHighResTimeGet();
+
+void Mailbox::post(const Command& command)
+{
+	/*
+	   Puts a command in the mailbox, replacing one
+	   that was not taken yet.  Only one task may
+	   post.
+	*/
+
+	slots[back] = command;
+	std::uint8_t previous =
+		__atomic_exchange_n(&middle, back | fresh, __ATOMIC_ACQ_REL);
+	back = previous & ~fresh;
+}
+
+bool Mailbox::take(Command& command)
+{
+	/*
+	   Takes the newest command, returns false if
+	   nothing was posted since the last take.  Only
+	   one task may take.
+	*/
+
+	if((__atomic_load_n(&middle, __ATOMIC_ACQUIRE) & fresh) == 0)
+	{
+		return false;
+	}
+
+	std::uint8_t previous =
+		__atomic_exchange_n(&middle, front, __ATOMIC_ACQ_REL);
+	front = previous & ~fresh;
+	command = slots[front];
+	return true;
+}
+
+Subsystem::Subsystem(const char* name, MotorGroup* group,
+					 void (*handler)(const ControllerSnapshot& input))
+{
+	/*
+	   Constructor for subsystem.
+
+	   The handler does one tick of driver control
+	   for the group, from a controller input.
+	*/
+
+	this->name = name;
+	this->group = group;
+	this->handler = handler;
+}
+
+Subsystem::~Subsystem()
+{
+	/*
+	   Destructor for subsystem.
+
+	   Stops the subsystem's task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void Subsystem::start(std::uint32_t priority)
+{
+	/*
+	   Starts the subsystem's task.  Subsystems that
+	   must react first get the higher priorities,
+	   all of them above the control loop so a post
+	   is handled before the loop goes on.
+	*/
+
+	if(task == nullptr)
+	{
+		task = new pros::Task(task_function, this, priority,
+							  TASK_STACK_DEPTH_DEFAULT, name);
+	}
+}
+
+void Subsystem::post(const ControllerSnapshot& input, std::uint64_t time)
+{
+	/*
+	   Hands an input read at time (get_time()) to
+	   the subsystem and wakes its task, or runs the
+	   handler right here if the task was not started.
+	*/
+
+	Command command{ input, time };
+	if(task == nullptr)
+	{
+		run(command, true);
+		return;
+	}
+
+	mailbox.post(command);
+	task->notify();
+}
+
+std::uint64_t Subsystem::get_time()
+{
+	/*
+	   Returns the microseconds since the brain
+	   started, to stamp inputs with.
+	*/
+
+	return vexSystemHighResTimeGet();
+}
+
+double Subsystem::get_average_latency()
+{
+	/*
+	   Returns the average latency since the last
+	   reset_latency().
+	*/
+
+	std::uint32_t count = latency_count;
+	return count == 0 ? 0 : latency_total / 1000.0 / count;
+}
+
+double Subsystem::get_max_latency()
+{
+	/*
+	   Returns the longest latency since the last
+	   reset_latency().
+	*/
+
+	return latency_max / 1000.0;
+}
+
+void Subsystem::reset_latency()
+{
+	/*
+	   Starts the latency figures over.
+	*/
+
+	latency_total = 0;
+	latency_count = 0;
+	latency_max = 0;
+}
+
+const char* Subsystem::get_name()
+{
+	/*
+	   Returns the name the subsystem's task has.
+	*/
+
+	return name;
+}
+
+void Subsystem::task_function(void* param)
+{
+	/*
+	   Entry point of a subsystem's task.  Wakes for
+	   each post, or every update interval to keep
+	   running the last input until it goes stale.
+	*/
+
+	Subsystem* subsystem = static_cast<Subsystem*>(param);
+	Command command;
+	bool active = false;
+
+	while(true)
+	{
+		pros::c::task_notify_take(true, update_interval);
+
+		bool fresh = subsystem->mailbox.take(command);
+		if(fresh)
+		{
+			active = true;
+		}
+		else if(active &&
+				get_time() - command.time > stale_timeout * 1000)
+		{
+			active = false;
+			subsystem->group->stop();
+		}
+
+		if(active)
+		{
+			subsystem->run(command, fresh);
+		}
+	}
+}
+
+void Subsystem::run(const Command& command, bool fresh)
+{
+	/*
+	   Runs the handler once.  New presses are
+	   worked out against the last input this
+	   subsystem saw, so one that was replaced in
+	   the mailbox before it was taken isn't lost.
+	*/
+
+	ControllerSnapshot input = command.input;
+	input.pressed = fresh ? input.digital & ~held : 0;
+	held = input.digital;
+
+	handler(input);
+
+	if(fresh)
+	{
+		std::uint32_t latency = get_time() - command.time;
+		latency_total += latency;
+		latency_count++;
+		if(latency > latency_max)
+		{
+			latency_max = latency;
+		}
+	}
+}
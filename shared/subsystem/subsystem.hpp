@@ -0,0 +1,113 @@
+#ifndef SUBSYSTEM_HPP
+#define SUBSYSTEM_HPP
+
+/*
+	The Mailbox class hands the latest controller
+	input from one task to another without a lock.
+
+	It is a triple buffer: the writer fills a spare
+	slot and swaps it in with one atomic exchange,
+	the reader swaps out the newest slot the same
+	way.  Neither side ever waits or retries, which
+	matters on a single core where a reader spinning
+	at a higher priority would never let a preempted
+	writer finish.  Only the newest input is kept.
+*/
+
+struct Command
+{
+	ControllerSnapshot input;
+	// microseconds (vexSystemHighResTimeGet) when the input was read
+	std::uint64_t time;
+};
+
+class Mailbox
+{
+	public:
+	void post(const Command& command);
+	bool take(Command& command);
+
+	private:
+	static constexpr std::uint8_t fresh = 0x4;
+
+	Command slots[3];
+	// slot the writer fills next and the slot the reader holds
+	std::uint8_t back = 0;
+	std::uint8_t front = 1;
+	// the slot in between, with fresh set once it was posted
+	std::uint8_t middle = 2;
+};
+
+/*
+	The Subsystem class runs the driver control of
+	one mechanism on its own task, so a slow
+	operation in one mechanism can't hold up the
+	others.  The subsystem's task is the only one
+	that commands its MotorGroup while driver
+	control runs, unless its handler hands the group
+	to another task: the ramp and scooper handlers
+	leave theirs to the StackDeploy task while a
+	deploy they triggered runs.
+
+	The control loop posts each controller reading,
+	with the time it was read, to every subsystem's
+	mailbox, which wakes the task to run its handler
+	straight away.  If no
+	input arrives the handler keeps running with the
+	last one every update interval, and once inputs
+	stop for stale_timeout the group is stopped and
+	left to autonomous.
+
+	The time from reading the controller to the
+	handler finishing is kept for each subsystem,
+	in microseconds from the V5 runtime's timer as
+	pros::millis() is too coarse to tell a handler
+	from nothing.  A subsystem that is never
+	started runs its handler inline in post(),
+	measured the same way, which is the serial loop
+	to compare against.
+*/
+
+class Subsystem
+{
+	public:
+	Subsystem(const char* name, MotorGroup* group,
+			  void (*handler)(const ControllerSnapshot& input));
+	~Subsystem();
+
+	// task control
+	void start(std::uint32_t priority);
+	void post(const ControllerSnapshot& input, std::uint64_t time);
+	static std::uint64_t get_time();
+
+	// latency (ms) from reading an input to acting on it
+	double get_average_latency();
+	double get_max_latency();
+	void reset_latency();
+
+	const char* get_name();
+
+	static constexpr std::uint32_t update_interval = 10;
+	static constexpr std::uint32_t stale_timeout = 100;
+
+	private:
+	static void task_function(void* param);
+	void run(const Command& command, bool fresh);
+
+	const char* name;
+	MotorGroup* group;
+	void (*handler)(const ControllerSnapshot& input);
+	Mailbox mailbox;
+
+	// buttons held in the last input, for new presses
+	std::uint16_t held = 0;
+
+	// microseconds, only written by the subsystem's task
+	volatile std::uint64_t latency_total = 0;
+	volatile std::uint32_t latency_count = 0;
+	volatile std::uint32_t latency_max = 0;
+
+	pros::Task* task = nullptr;
+};
+
+#endif
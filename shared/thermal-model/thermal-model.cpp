@@ -0,0 +1,209 @@
+#include "main.h"
+
+#include "thermal-model.hpp"
+
+#include <cmath>
+
+ThermalModel::ThermalModel()
+{
+	/*
+	   Constructor for thermal model.
+
+	   Groups are added with add_group() and the
+	   model runs once start() is called.
+	*/
+}
+
+ThermalModel::~ThermalModel()
+{
+	/*
+	   Destructor for thermal model.
+
+	   Stops the model task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void ThermalModel::start()
+{
+	/*
+	   Starts the task that updates one motor every
+	   update interval.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_MIN + 1,
+						  TASK_STACK_DEPTH_DEFAULT, "thermal model");
+}
+
+void ThermalModel::add_group(MotorGroup* group)
+{
+	/*
+	   Registers every motor of a motor group with
+	   the model.  All motors start at ambient
+	   temperature until they are first sampled.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	for(std::size_t i = 0; i < group->size(); i++)
+	{
+		states.push_back(MotorState{ group, group->get_motor(i),
+									 ambient_temperature, 0, 0, INFINITY });
+	}
+	mutex.give();
+}
+
+void ThermalModel::task_function(void* param)
+{
+	/*
+	   Entry point of the model task.
+	*/
+
+	ThermalModel* model = static_cast<ThermalModel*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		model->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void ThermalModel::update()
+{
+	/*
+	   Samples the next motor in turn, advances its
+	   model and rescales the group it belongs to.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	if(!states.empty())
+	{
+		MotorState& state = states[next_state];
+		next_state = (next_state + 1) % states.size();
+
+		state.time_to_derate = predict(state);
+		update_scale(state.group);
+	}
+	mutex.give();
+}
+
+double ThermalModel::predict(MotorState& state)
+{
+	/*
+	   Advances the model of one motor to now and
+	   returns the predicted time (s) until it
+	   reaches the derate temperature.
+
+	   The temperature settles exponentially towards
+	   ambient + heating * time_constant * I^2, so
+	   the time to cross the derate temperature has
+	   a closed form.
+	*/
+
+	std::uint32_t now = pros::millis();
+	double dt = state.last_update == 0 ? 0 :
+										  (now - state.last_update) / 1000.0;
+	state.last_update = now;
+
+	double current = state.motor->get_current_draw();
+	if(current != PROS_ERR)
+	{
+		// smooth the current so one spike doesn't swing the prediction
+		double amps = current / 1000.0;
+		state.current_squared += 0.3 * (amps * amps - state.current_squared);
+	}
+
+	double steady = ambient_temperature +
+					heating * time_constant * state.current_squared;
+	state.temperature +=
+		(steady - state.temperature) * (1 - exp(-dt / time_constant));
+
+	double measured = state.motor->get_temperature();
+	if(measured != PROS_ERR_F)
+	{
+		state.temperature += measurement_gain * (measured - state.temperature);
+	}
+
+	if(state.temperature >= derate_temperature)
+	{
+		return 0;
+	}
+	if(steady <= derate_temperature)
+	{
+		return INFINITY;
+	}
+	return time_constant * log((steady - state.temperature) /
+							   (steady - derate_temperature));
+}
+
+void ThermalModel::update_scale(MotorGroup* group)
+{
+	/*
+	   Sets a group's output scale from the motor
+	   closest to derating.
+
+	   The scale falls linearly from 1 at the horizon
+	   to min_scale at the derate point and only moves
+	   a little per update, so the driver feels a
+	   gradual slow down instead of a step.
+	*/
+
+	double time_to_derate = INFINITY;
+	for(MotorState& state : states)
+	{
+		if(state.group == group)
+		{
+			time_to_derate = std::min(time_to_derate, state.time_to_derate);
+		}
+	}
+
+	double target = 1;
+	if(time_to_derate < horizon)
+	{
+		target = min_scale + (1 - min_scale) * time_to_derate / horizon;
+	}
+
+	double scale = group->get_output_scale();
+	if(target > scale + max_scale_step)
+	{
+		target = scale + max_scale_step;
+	}
+	else if(target < scale - max_scale_step)
+	{
+		target = scale - max_scale_step;
+	}
+	group->set_output_scale(target);
+}
+
+double ThermalModel::get_time_to_derate(MotorGroup* group)
+{
+	/*
+	   Returns the predicted time (s) until the
+	   first motor of a group derates.  INFINITY
+	   means the group is not heading there at its
+	   current load.
+	*/
+
+	double time_to_derate = INFINITY;
+
+	mutex.take(TIMEOUT_MAX);
+	for(MotorState& state : states)
+	{
+		if(state.group == group)
+		{
+			time_to_derate = std::min(time_to_derate, state.time_to_derate);
+		}
+	}
+	mutex.give();
+	return time_to_derate;
+}
@@ -0,0 +1,74 @@
+#ifndef THERMAL_MODEL_HPP
+#define THERMAL_MODEL_HPP
+
+/*
+	The ThermalModel class predicts when each motor
+	will reach the temperature where the firmware
+	halves its output.
+
+	Each motor has a first order model: it heats with
+	the square of its current and cools towards the
+	ambient temperature.  The estimate is pulled
+	towards the measured temperature (which is coarse)
+	on every sample.  When a motor is predicted to
+	derate soon its group's output is eased off so the
+	drop is gradual instead of sudden.
+
+	Only one motor is sampled per update so the cost
+	to the rest of the program stays tiny.
+*/
+
+class ThermalModel
+{
+	public:
+	ThermalModel();
+	~ThermalModel();
+
+	// task control
+	void start();
+	void update();
+
+	// groups
+	void add_group(MotorGroup* group);
+
+	// predictions
+	double get_time_to_derate(MotorGroup* group);
+
+	static constexpr std::uint32_t update_interval = 50;
+	// temperature (celsius) where the firmware starts derating
+	static constexpr double derate_temperature = 55;
+	static constexpr double ambient_temperature = 25;
+	// time constant (s) and heating (celsius / A^2 s) of a motor
+	static constexpr double time_constant = 300;
+	static constexpr double heating = 0.032;
+	// how much of each measurement is blended into the estimate
+	static constexpr double measurement_gain = 0.2;
+	// outputs start easing off this many seconds before derating
+	static constexpr double horizon = 60;
+	static constexpr double min_scale = 0.7;
+	// largest change in output scale per update of a group
+	static constexpr double max_scale_step = 0.02;
+
+	private:
+	struct MotorState
+	{
+		MotorGroup* group;
+		pros::Motor* motor;
+
+		double temperature;
+		double current_squared;
+		std::uint32_t last_update;
+		double time_to_derate;
+	};
+
+	static void task_function(void* param);
+	double predict(MotorState& state);
+	void update_scale(MotorGroup* group);
+
+	std::vector<MotorState> states;
+	std::size_t next_state = 0;
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+};
+
+#endif
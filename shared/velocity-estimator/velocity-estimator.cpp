@@ -0,0 +1,155 @@
+#include "main.h"
+
+#include "velocity-estimator.hpp"
+
+#include <algorithm>
+
+VelocityEstimator::VelocityEstimator()
+{
+	/*
+	   Constructor for velocity estimator.
+
+	   Estimates are unfiltered until set_filter()
+	   is called.
+	*/
+
+	reset();
+}
+
+void VelocityEstimator::set_filter(VelocityFilter filter, double alpha,
+								   double beta)
+{
+	/*
+	   Picks the filter applied to both estimates.
+
+	   alpha is the weight of a new sample for ema
+	   and dema, between 0 and 1, lower is smoother.
+	   beta is dema's weight of a new trend.  The
+	   median ignores both.
+	*/
+
+	this->filter = filter;
+	this->alpha = alpha;
+	this->beta = beta;
+	reset();
+}
+
+void VelocityEstimator::reset()
+{
+	/*
+	   Forgets every sample, for example after the
+	   position was zeroed.
+	*/
+
+	sample_count = 0;
+	velocity = 0;
+	acceleration = 0;
+	velocity_filter.count = 0;
+	acceleration_filter.count = 0;
+}
+
+void VelocityEstimator::add_sample(double position, std::uint32_t timestamp)
+{
+	/*
+	   Adds a position sample and the time (ms) it
+	   was taken.  A sample no newer than the last
+	   one is ignored, so this can be called every
+	   tick even if the sensor has not updated.
+	*/
+
+	if(sample_count > 0 && timestamp == this->timestamp)
+	{
+		return;
+	}
+
+	if(sample_count > 0)
+	{
+		double dt = (timestamp - this->timestamp) / 1000.0;
+		double estimate =
+			apply(velocity_filter, (position - this->position) / dt);
+		if(sample_count > 1)
+		{
+			acceleration =
+				apply(acceleration_filter, (estimate - velocity) / dt);
+		}
+		velocity = estimate;
+	}
+
+	this->position = position;
+	this->timestamp = timestamp;
+	sample_count++;
+}
+
+double VelocityEstimator::get_velocity()
+{
+	/*
+	   Returns the latest velocity, 0 until two
+	   samples were added.
+	*/
+
+	return velocity;
+}
+
+double VelocityEstimator::get_acceleration()
+{
+	/*
+	   Returns the latest acceleration, 0 until
+	   three samples were added.
+	*/
+
+	return acceleration;
+}
+
+double VelocityEstimator::apply(Filter& state, double raw)
+{
+	/*
+	   Runs a raw estimate through the filter.
+
+	   Each filter starts from its first sample
+	   rather than from 0, so a moving mechanism
+	   isn't reported as slowly speeding up.
+	*/
+
+	switch(filter)
+	{
+		case VelocityFilter::ema:
+			state.value = state.count == 0
+							  ? raw
+							  : alpha * raw + (1 - alpha) * state.value;
+			state.count++;
+			return state.value;
+		case VelocityFilter::dema:
+		{
+			if(state.count == 0)
+			{
+				state.value = raw;
+				state.trend = 0;
+			}
+			else
+			{
+				double last = state.value;
+				state.value =
+					alpha * raw + (1 - alpha) * (state.value + state.trend);
+				state.trend =
+					beta * (state.value - last) + (1 - beta) * state.trend;
+			}
+			state.count++;
+			return state.value;
+		}
+		case VelocityFilter::median:
+		{
+			state.window[state.count % median_size] = raw;
+			state.count++;
+
+			std::size_t size = std::min(state.count, median_size);
+			double sorted[median_size];
+			std::copy(state.window, state.window + size, sorted);
+			std::sort(sorted, sorted + size);
+			return size % 2 == 1
+					   ? sorted[size / 2]
+					   : (sorted[size / 2 - 1] + sorted[size / 2]) / 2;
+		}
+		default:
+			return raw;
+	}
+}
@@ -0,0 +1,74 @@
+#ifndef VELOCITY_ESTIMATOR_HPP
+#define VELOCITY_ESTIMATOR_HPP
+
+/*
+	The VelocityEstimator class works out velocity
+	and acceleration from position samples and the
+	time each sample was taken, like the ones
+	pros::Motor::get_raw_position returns.
+
+	Dividing by the real time between samples keeps
+	the estimate right when a task runs late or a
+	motor reports early, and it lags far less than
+	get_actual_velocity.  Finite differences are
+	noisy, so the estimates can be smoothed with the
+	same filters okapi offers: an exponential moving
+	average, a double exponential moving average
+	that follows ramps without lagging behind them,
+	or a median over the last few samples.
+*/
+
+enum class VelocityFilter
+{
+	none,
+	ema,
+	dema,
+	median
+};
+
+class VelocityEstimator
+{
+	public:
+	VelocityEstimator();
+
+	// configuration
+	void set_filter(VelocityFilter filter, double alpha = 0.5,
+					double beta = 0.5);
+
+	// samples
+	void reset();
+	void add_sample(double position, std::uint32_t timestamp);
+
+	// estimates, in position units per second (squared)
+	double get_velocity();
+	double get_acceleration();
+
+	static constexpr std::size_t median_size = 5;
+
+	private:
+	struct Filter
+	{
+		std::size_t count;
+		// ema and dema
+		double value;
+		double trend;
+		// median, a ring of the last samples
+		double window[median_size];
+	};
+
+	double apply(Filter& state, double raw);
+
+	VelocityFilter filter = VelocityFilter::none;
+	double alpha = 0.5;
+	double beta = 0.5;
+	Filter velocity_filter;
+	Filter acceleration_filter;
+
+	std::size_t sample_count = 0;
+	double position = 0;
+	std::uint32_t timestamp = 0;
+	double velocity = 0;
+	double acceleration = 0;
+};
+
+#endif
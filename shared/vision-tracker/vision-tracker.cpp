@@ -0,0 +1,293 @@
+#include "main.h"
+
+#include "vision-tracker.hpp"
+
+#include <cmath>
+
+VisionTracker::VisionTracker(pros::Vision* sensor, std::uint8_t signature,
+							 double target_width)
+{
+	/*
+	   Constructor for vision tracker.
+
+	   Tracks objects of the given signature (1 to
+	   7), target_width is how wide they are in
+	   inches.  Nothing is read until start().
+	*/
+
+	this->sensor = sensor;
+	this->signature = signature;
+	this->target_width = target_width;
+	focal_length =
+		VISION_FOV_WIDTH / 2.0 / tan(field_of_view / 2 * M_PI / 180);
+
+	for(Track& track : tracks)
+	{
+		track.active = false;
+	}
+	target_filter.set_ema(0.5);
+}
+
+VisionTracker::~VisionTracker()
+{
+	/*
+	   Destructor for vision tracker.
+
+	   Stops the tracking task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void VisionTracker::start()
+{
+	/*
+	   Starts the task that reads each frame of the
+	   sensor, with the image centred on (0, 0).
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	sensor->set_zero_point(pros::E_VISION_ZERO_CENTER);
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT,
+						  TASK_STACK_DEPTH_DEFAULT, "vision tracker");
+}
+
+void VisionTracker::task_function(void* param)
+{
+	/*
+	   Entry point of the tracking task.
+	*/
+
+	VisionTracker* tracker = static_cast<VisionTracker*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		tracker->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void VisionTracker::update()
+{
+	/*
+	   Reads one frame, matches its objects to the
+	   tracks and updates the target.
+
+	   The sensor reports an error when it sees no
+	   object, which counts as an empty frame.
+	*/
+
+	std::int32_t count =
+		sensor->read_by_sig(0, signature, max_objects, objects);
+	if(count == PROS_ERR || count < 0)
+	{
+		count = 0;
+	}
+
+	mutex.take(TIMEOUT_MAX);
+	associate(count);
+	pick_target();
+	mutex.give();
+}
+
+bool VisionTracker::has_target()
+{
+	/*
+	   Returns true while a target is locked.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	bool locked = target >= 0;
+	mutex.give();
+	return locked;
+}
+
+double VisionTracker::get_bearing()
+{
+	/*
+	   Returns the bearing of the target in degrees,
+	   positive to the right of the sensor, 0 if
+	   there is no target.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double bearing = target >= 0 ? target_filter.get_output(0) : 0;
+	mutex.give();
+	return bearing;
+}
+
+double VisionTracker::get_range()
+{
+	/*
+	   Returns the range of the target in inches,
+	   0 if there is no target.
+	*/
+
+	mutex.take(TIMEOUT_MAX);
+	double range = target >= 0 ? target_filter.get_output(1) : 0;
+	mutex.give();
+	return range;
+}
+
+bool VisionTracker::assist(MotorGroup* drive, int forward)
+{
+	/*
+	   Steers a drive train onto the target while it
+	   moves at the given forward speed, the driver
+	   keeping control of how fast it closes in.
+
+	   Returns false and leaves the drive alone if
+	   there is no target.
+	*/
+
+	if(!has_target())
+	{
+		return false;
+	}
+
+	int turn = get_bearing() * assist_gain;
+	if(turn > max_assist_turn)
+	{
+		turn = max_assist_turn;
+	}
+	else if(turn < -max_assist_turn)
+	{
+		turn = -max_assist_turn;
+	}
+	drive->run_tank(forward + turn, forward - turn);
+	return true;
+}
+
+void VisionTracker::associate(std::size_t object_count)
+{
+	/*
+	   Matches each object, biggest first as the
+	   sensor sorts them, to the nearest unmatched
+	   track close enough to be the same object.
+	   Objects with no track start a new one, in the
+	   slot of the stalest track if none is free.
+	*/
+
+	for(Track& track : tracks)
+	{
+		track.matched = false;
+	}
+
+	for(std::size_t i = 0; i < object_count; i++)
+	{
+		const pros::vision_object_s_t& object = objects[i];
+		int x = object.x_middle_coord;
+		int y = object.y_middle_coord;
+
+		int best = -1;
+		int best_distance = match_distance * match_distance;
+		for(std::size_t j = 0; j < max_tracks; j++)
+		{
+			const Track& track = tracks[j];
+			int dx = track.x - x;
+			int dy = track.y - y;
+			int distance = dx * dx + dy * dy;
+			if(track.active && !track.matched && distance <= best_distance)
+			{
+				best = j;
+				best_distance = distance;
+			}
+		}
+
+		if(best < 0)
+		{
+			for(std::size_t j = 0; j < max_tracks; j++)
+			{
+				if(!tracks[j].active)
+				{
+					best = j;
+					break;
+				}
+				if(!tracks[j].matched &&
+				   (best < 0 || tracks[j].missed > tracks[best].missed))
+				{
+					best = j;
+				}
+			}
+			if(best < 0)
+			{
+				continue;
+			}
+			if(best == target)
+			{
+				target = -1;
+			}
+			tracks[best] = Track{ true, false, x, y, 0, 0, 0 };
+		}
+
+		Track& track = tracks[best];
+		track.matched = true;
+		track.x = x;
+		track.y = y;
+		track.width = object.width;
+		track.seen++;
+		track.missed = 0;
+	}
+
+	for(std::size_t j = 0; j < max_tracks; j++)
+	{
+		Track& track = tracks[j];
+		if(track.active && !track.matched && ++track.missed > drop_frames)
+		{
+			track.active = false;
+			if(static_cast<int>(j) == target)
+			{
+				target = -1;
+			}
+		}
+	}
+}
+
+void VisionTracker::pick_target()
+{
+	/*
+	   Keeps the target while it is tracked, or
+	   locks onto the widest confirmed track, then
+	   feeds the target's bearing and range to the
+	   filter.  A new target restarts the filter so
+	   it doesn't slide over from the old one.
+	*/
+
+	if(target < 0)
+	{
+		int widest = 0;
+		for(std::size_t j = 0; j < max_tracks; j++)
+		{
+			const Track& track = tracks[j];
+			if(track.active && track.matched && track.seen >= confirm_frames &&
+			   track.width > widest)
+			{
+				target = j;
+				widest = track.width;
+			}
+		}
+		if(target < 0)
+		{
+			return;
+		}
+		target_filter.reset();
+	}
+
+	const Track& track = tracks[target];
+	if(!track.matched || track.width <= 0)
+	{
+		return;
+	}
+	target_filter.set_input(0, atan2(track.x, focal_length) * 180 / M_PI);
+	target_filter.set_input(1, target_width * focal_length / track.width);
+	target_filter.update();
+}
@@ -0,0 +1,92 @@
+#ifndef VISION_TRACKER_HPP
+#define VISION_TRACKER_HPP
+
+/*
+	The VisionTracker class follows objects of one
+	signature seen by the vision sensor and reports
+	the bearing and range of the one it is locked
+	onto.
+
+	Its task reads every frame into a fixed array
+	and matches each object to the nearest track
+	from the frame before, so an object keeps its
+	track while it moves and a single missed frame
+	doesn't lose it.  The target is the biggest
+	track that has been seen for a few frames, and
+	it stays the target until it is lost.  Bearing
+	comes from where the target is across the
+	image and range from how wide it looks, both
+	smoothed over a few frames.
+
+	Nothing is allocated after construction, so the
+	task can run beside the control loops.
+*/
+
+class VisionTracker
+{
+	public:
+	VisionTracker(pros::Vision* sensor, std::uint8_t signature,
+				  double target_width);
+	~VisionTracker();
+
+	// task control
+	void start();
+	void update();
+
+	// target
+	bool has_target();
+	double get_bearing();
+	double get_range();
+
+	// drive assist
+	bool assist(MotorGroup* drive, int forward);
+
+	// the sensor sends a frame every 20ms
+	static constexpr std::uint32_t update_interval = 20;
+	static constexpr std::size_t max_objects = 8;
+	static constexpr std::size_t max_tracks = 8;
+	// horizontal field of view (degrees) across VISION_FOV_WIDTH pixels
+	static constexpr double field_of_view = 61;
+	// furthest an object moves between frames (pixels) and stays matched
+	static constexpr int match_distance = 40;
+	// frames a track is seen before it can be the target and missed
+	// before it is dropped
+	static constexpr int confirm_frames = 3;
+	static constexpr int drop_frames = 5;
+	// turn speed per degree of bearing and the most the assist turns
+	static constexpr double assist_gain = 2.5;
+	static constexpr int max_assist_turn = 60;
+
+	private:
+	struct Track
+	{
+		bool active;
+		bool matched;
+		int x;
+		int y;
+		int width;
+		int seen;
+		int missed;
+	};
+
+	static void task_function(void* param);
+	void associate(std::size_t object_count);
+	void pick_target();
+
+	pros::Vision* sensor;
+	std::uint8_t signature;
+	// inches the target is across and the lens focal length in pixels
+	double target_width;
+	double focal_length;
+
+	pros::vision_object_s_t objects[max_objects];
+	Track tracks[max_tracks];
+	int target = -1;
+	// bearing (degrees) and range (inches) of the target
+	FilterBank target_filter{ 2 };
+
+	pros::Task* task = nullptr;
+	pros::Mutex mutex;
+};
+
+#endif
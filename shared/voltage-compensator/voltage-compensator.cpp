@@ -0,0 +1,114 @@
+#include "main.h"
+
+#include "voltage-compensator.hpp"
+
+#include <algorithm>
+
+VoltageCompensator::VoltageCompensator(int nominal_voltage)
+{
+	/*
+	   Constructor for voltage compensator.  Takes
+	   the voltage (mV) that a full output is scaled
+	   to, at most full_voltage.
+	*/
+
+	this->nominal_voltage = nominal_voltage;
+	this->battery_voltage = nominal_voltage;
+}
+
+VoltageCompensator::~VoltageCompensator()
+{
+	/*
+	   Destructor for voltage compensator.
+
+	   Stops the task and removes the compensation.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+	MotorGroup::set_voltage_scale(1);
+}
+
+void VoltageCompensator::start()
+{
+	/*
+	   Takes a first reading and starts the task
+	   that updates the compensation every update
+	   interval.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	int voltage = pros::battery::get_voltage();
+	if(voltage != PROS_ERR && voltage > min_voltage)
+	{
+		battery_voltage = voltage;
+	}
+	apply();
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT,
+						  TASK_STACK_DEPTH_MIN, "voltage compensator");
+}
+
+void VoltageCompensator::task_function(void* param)
+{
+	/*
+	   Entry point of the compensation task.
+	*/
+
+	VoltageCompensator* compensator = static_cast<VoltageCompensator*>(param);
+	std::uint32_t now = pros::millis();
+
+	while(true)
+	{
+		compensator->update();
+		pros::Task::delay_until(&now, update_interval);
+	}
+}
+
+void VoltageCompensator::update()
+{
+	/*
+	   Reads the battery, smooths the reading and
+	   updates the scale used by every MotorGroup.
+
+	   Readings that fail or are impossibly low are
+	   ignored so a glitch can't spike the outputs.
+	*/
+
+	int voltage = pros::battery::get_voltage();
+	if(voltage == PROS_ERR || voltage < min_voltage)
+	{
+		return;
+	}
+
+	battery_voltage += smoothing * (voltage - battery_voltage);
+	apply();
+}
+
+void VoltageCompensator::apply()
+{
+	/*
+	   Sets the scale of every MotorGroup so a full
+	   output asks for the nominal voltage, or the
+	   whole battery once it has less.
+	*/
+
+	double voltage = std::min<double>(nominal_voltage, battery_voltage);
+	MotorGroup::set_voltage_scale(voltage / full_voltage);
+}
+
+double VoltageCompensator::get_battery_voltage()
+{
+	/*
+	   Returns the smoothed battery voltage (mV).
+	*/
+
+	return battery_voltage;
+}
@@ -0,0 +1,52 @@
+#ifndef VOLTAGE_COMPENSATOR_HPP
+#define VOLTAGE_COMPENSATOR_HPP
+
+/*
+	The VoltageCompensator class keeps motor outputs
+	independent of battery charge.
+
+	The motor firmware holds the voltage it is sent
+	(move_voltage), but it can't give more than the
+	battery has, so on a tired battery the fastest
+	outputs are cut short and the same PID gains
+	drive differently.  The compensator has every
+	MotorGroup map its full output to the nominal
+	voltage, below what a battery sags to in a
+	match, so every output is delivered whatever the
+	charge.  It reads the battery at a low rate and
+	smooths it, and should it fall below the nominal
+	voltage all outputs are scaled down together so
+	none are cut short on their own.
+*/
+
+class VoltageCompensator
+{
+	public:
+	VoltageCompensator(int nominal_voltage = 12000);
+	~VoltageCompensator();
+
+	// task control
+	void start();
+	void update();
+
+	// readings
+	double get_battery_voltage();
+
+	static constexpr std::uint32_t update_interval = 100;
+	// weight of each new reading, the battery sags under load
+	static constexpr double smoothing = 0.2;
+	// below this (mV) a reading is treated as an error
+	static constexpr int min_voltage = 9000;
+	// mV a full output asks for without the compensator
+	static constexpr int full_voltage = 12000;
+
+	private:
+	static void task_function(void* param);
+	void apply();
+
+	int nominal_voltage;
+	double battery_voltage;
+	pros::Task* task = nullptr;
+};
+
+#endif
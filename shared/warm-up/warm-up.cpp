@@ -0,0 +1,229 @@
+#include "main.h"
+
+#include "warm-up.hpp"
+
+WarmUp::WarmUp()
+{
+	/*
+	   Constructor for warm up.
+
+	   Groups, the imu and stages are added before
+	   start() is called.
+	*/
+}
+
+WarmUp::~WarmUp()
+{
+	/*
+	   Destructor for warm up.
+
+	   Stops the warm up task if it was started.
+	*/
+
+	if(task != nullptr)
+	{
+		task->remove();
+		delete task;
+	}
+}
+
+void WarmUp::add_group(MotorGroup* group)
+{
+	/*
+	   Registers a motor group whose ports are
+	   checked for faults.
+
+	   Up to max_groups groups can be added, the
+	   rest are ignored.
+	*/
+
+	if(group_count < max_groups)
+	{
+		groups[group_count++] = group;
+	}
+}
+
+void WarmUp::add_imu(pros::Imu* imu)
+{
+	/*
+	   Sets the inertial sensor to calibrate.  The
+	   robot must not be moved while it calibrates.
+	*/
+
+	this->imu = imu;
+}
+
+void WarmUp::add_stage(void (*stage)())
+{
+	/*
+	   Adds a preparation step, run once after the
+	   imu is calibrated and in the order added.
+
+	   Up to max_stages stages can be added, the
+	   rest are ignored.
+	*/
+
+	if(stage_count < max_stages)
+	{
+		stages[stage_count++] = stage;
+	}
+}
+
+void WarmUp::start()
+{
+	/*
+	   Starts the warm up task.
+
+	   Called from initialize() so it also runs
+	   when there is no competition switch, below
+	   the default priority to stay out of the way
+	   of the control loops.
+	*/
+
+	if(task != nullptr)
+	{
+		return;
+	}
+
+	task = new pros::Task(task_function, this, TASK_PRIORITY_DEFAULT - 1,
+						  TASK_STACK_DEPTH_DEFAULT, "warm up");
+}
+
+bool WarmUp::wait(std::uint32_t timeout)
+{
+	/*
+	   Blocks the calling task until every stage
+	   has run, or the timeout (ms) passes.
+
+	   Returns straight away when the warm up
+	   finished while the robot was disabled.  The
+	   waiting task is published before ready is
+	   checked and the warm up sets ready before it
+	   looks for a waiting task, so one of the two
+	   always sees the other.
+	*/
+
+	waiting = pros::c::task_get_current();
+	if(!ready)
+	{
+		pros::c::task_notify_take(true, timeout);
+	}
+	waiting = nullptr;
+
+	return ready;
+}
+
+bool WarmUp::is_ready()
+{
+	/*
+	   Returns true once every stage has run.
+	*/
+
+	return ready;
+}
+
+int WarmUp::get_fault_count()
+{
+	/*
+	   Returns how many motors failed the last
+	   port check.
+	*/
+
+	return fault_count;
+}
+
+std::uint8_t WarmUp::get_faulty_port()
+{
+	/*
+	   Returns the first port that failed the last
+	   port check, 0 if all passed.
+	*/
+
+	return faulty_port;
+}
+
+void WarmUp::task_function(void* param)
+{
+	/*
+	   Entry point of the warm up task.
+	*/
+
+	WarmUp* warm_up = static_cast<WarmUp*>(param);
+
+	warm_up->check_ports();
+	warm_up->calibrate_imu();
+	for(std::size_t i = 0; i < warm_up->stage_count; i++)
+	{
+		warm_up->stages[i]();
+	}
+
+	warm_up->ready = true;
+	pros::task_t waiting = warm_up->waiting;
+	if(waiting != nullptr)
+	{
+		pros::c::task_notify(waiting);
+	}
+
+	std::uint32_t now = pros::millis();
+	while(true)
+	{
+		if(pros::competition::is_disabled())
+		{
+			warm_up->check_ports();
+		}
+		pros::Task::delay_until(&now, check_interval);
+	}
+}
+
+void WarmUp::check_ports()
+{
+	/*
+	   Checks every motor of the registered groups.
+
+	   A motor that is unplugged fails to report a
+	   temperature, one that is over temperature,
+	   over current or has a driver fault reports
+	   it in its fault flags.
+	*/
+
+	int faults = 0;
+	std::uint8_t first_port = 0;
+
+	for(std::size_t i = 0; i < group_count; i++)
+	{
+		for(std::size_t j = 0; j < groups[i]->size(); j++)
+		{
+			pros::Motor* motor = groups[i]->get_motor(j);
+			if(motor->get_temperature() == PROS_ERR_F ||
+			   motor->get_faults() != 0)
+			{
+				if(faults++ == 0)
+				{
+					first_port = motor->get_port();
+				}
+			}
+		}
+	}
+
+	fault_count = faults;
+	faulty_port = first_port;
+}
+
+void WarmUp::calibrate_imu()
+{
+	/*
+	   Starts the imu calibration and waits for it
+	   to finish, at most imu_timeout ms.
+	*/
+
+	if(imu == nullptr || imu->reset() == PROS_ERR)
+	{
+		return;
+	}
+
+	std::uint32_t start = pros::millis();
+	while(imu->is_calibrating() && pros::millis() - start < imu_timeout)
+	{
+		pros::delay(10);
+	}
+}
@@ -0,0 +1,62 @@
+#ifndef WARM_UP_HPP
+#define WARM_UP_HPP
+
+/*
+	The WarmUp class does the slow preparation for
+	autonomous on its own task while the robot sits
+	disabled, so autonomous can start moving on its
+	first tick.
+
+	It checks every motor port for faults, calibrates
+	the inertial sensor and then runs the stages the
+	user adds (loading routines or recordings from
+	the sd card) once, in order.  The ports keep
+	being checked for as long as the robot is
+	disabled.
+*/
+
+class WarmUp
+{
+	public:
+	WarmUp();
+	~WarmUp();
+
+	// pipeline
+	void add_group(MotorGroup* group);
+	void add_imu(pros::Imu* imu);
+	void add_stage(void (*stage)());
+
+	// task control
+	void start();
+	bool wait(std::uint32_t timeout);
+
+	// results
+	bool is_ready();
+	int get_fault_count();
+	std::uint8_t get_faulty_port();
+
+	static constexpr std::size_t max_groups = 8;
+	static constexpr std::size_t max_stages = 8;
+	static constexpr std::uint32_t imu_timeout = 3000;
+	static constexpr std::uint32_t check_interval = 500;
+
+	private:
+	static void task_function(void* param);
+	void check_ports();
+	void calibrate_imu();
+
+	MotorGroup* groups[max_groups];
+	std::size_t group_count = 0;
+	pros::Imu* imu = nullptr;
+	void (*stages[max_stages])();
+	std::size_t stage_count = 0;
+
+	std::atomic<bool> ready{ false };
+	std::atomic<int> fault_count{ 0 };
+	std::atomic<std::uint8_t> faulty_port{ 0 };
+
+	pros::Task* task = nullptr;
+	std::atomic<pros::task_t> waiting{ nullptr };
+};
+
+#endif